@@ -19,12 +19,17 @@ OBJECTS_DIR = obj
 HEADERS += ASDetector/carriagetrack.h \
            ASDetector/ctrackdetector.h \
            ASDetector/ctracksection.h \
+           ASDetector/ctrackspans.h \
            ASDetector/plateau.h \
            ASDetector/plateaumodel.h \
+           ASDetector/plateaupool.h \
+           ASDetector/scansorter.h \
            Amrel/amrelconfig.h \
            Amrel/amrelmap.h \
            Amrel/amreltimer.h \
            Amrel/amreltool.h \
+           Amrel/asdregion.h \
+           Amrel/seedfile.h \
            BlurredSegment/antipodal.h \
            BlurredSegment/biptlist.h \
            BlurredSegment/blurredsegment.h \
@@ -32,25 +37,19 @@ HEADERS += ASDetector/carriagetrack.h \
            BlurredSegment/bsproto.h \
            BlurredSegment/bstracker.h \
            BlurredSegment/chvertex.h \
+           BlurredSegment/chvertexpool.h \
            BlurredSegment/convexhull.h \
            BlurredSegment/nfafilter.h \
-           DirectionalScanner/adaptivescannero1.h \
-           DirectionalScanner/adaptivescannero2.h \
-           DirectionalScanner/adaptivescannero7.h \
-           DirectionalScanner/adaptivescannero8.h \
            DirectionalScanner/directionalscanner.h \
-           DirectionalScanner/directionalscannero1.h \
-           DirectionalScanner/directionalscannero2.h \
-           DirectionalScanner/directionalscannero7.h \
-           DirectionalScanner/directionalscannero8.h \
+           DirectionalScanner/scanneradapter.h \
+           DirectionalScanner/scanstrip.h \
            DirectionalScanner/scannerprovider.h \
-           DirectionalScanner/vhscannero1.h \
-           DirectionalScanner/vhscannero2.h \
-           DirectionalScanner/vhscannero7.h \
-           DirectionalScanner/vhscannero8.h \
+           DirectionalScanner/steppatterns.h \
+           DirectionalScanner/stripscanner.h \
            ImageTools/absrat.h \
            ImageTools/digitalstraightline.h \
            ImageTools/digitalstraightsegment.h \
+           ImageTools/dssfile.h \
            ImageTools/edist.h \
            ImageTools/pt2i.h \
            ImageTools/vmap.h \
@@ -79,12 +78,17 @@ SOURCES += main.cpp \
            ASDetector/carriagetrack.cpp \
            ASDetector/ctrackdetector.cpp \
            ASDetector/ctracksection.cpp \
+           ASDetector/ctrackspans.cpp \
            ASDetector/plateau.cpp \
            ASDetector/plateaumodel.cpp \
+           ASDetector/plateaupool.cpp \
+           ASDetector/scansorter.cpp \
            Amrel/amrelconfig.cpp \
            Amrel/amrelmap.cpp \
            Amrel/amreltimer.cpp \
            Amrel/amreltool.cpp \
+           Amrel/asdregion.cpp \
+           Amrel/seedfile.cpp \
            BlurredSegment/antipodal.cpp \
            BlurredSegment/biptlist.cpp \
            BlurredSegment/blurredsegment.cpp \
@@ -92,24 +96,16 @@ SOURCES += main.cpp \
            BlurredSegment/bsproto.cpp \
            BlurredSegment/bstracker.cpp \
            BlurredSegment/chvertex.cpp \
+           BlurredSegment/chvertexpool.cpp \
            BlurredSegment/convexhull.cpp \
            BlurredSegment/nfafilter.cpp \
-           DirectionalScanner/adaptivescannero1.cpp \
-           DirectionalScanner/adaptivescannero2.cpp \
-           DirectionalScanner/adaptivescannero7.cpp \
-           DirectionalScanner/adaptivescannero8.cpp \
            DirectionalScanner/directionalscanner.cpp \
-           DirectionalScanner/directionalscannero1.cpp \
-           DirectionalScanner/directionalscannero2.cpp \
-           DirectionalScanner/directionalscannero7.cpp \
-           DirectionalScanner/directionalscannero8.cpp \
            DirectionalScanner/scannerprovider.cpp \
-           DirectionalScanner/vhscannero1.cpp \
-           DirectionalScanner/vhscannero2.cpp \
-           DirectionalScanner/vhscannero7.cpp \
-           DirectionalScanner/vhscannero8.cpp \
+           DirectionalScanner/steppatterns.cpp \
+           DirectionalScanner/stripscanner.cpp \
            ImageTools/digitalstraightline.cpp \
            ImageTools/digitalstraightsegment.cpp \
+           ImageTools/dssfile.cpp \
            ImageTools/edist.cpp \
            ImageTools/pt2i.cpp \
            ImageTools/vmap.cpp \
@@ -22,7 +22,6 @@
 #include "carriagetrack.h"
 #include "scannerprovider.h"
 #include <cmath>
-#include <algorithm>
 
 
 const float CarriageTrack::MIN_WIDTH = 2.0f;
@@ -56,37 +55,37 @@ CarriageTrack::~CarriageTrack ()
 }
 
 
-void CarriageTrack::clear (bool onright)
+void CarriageTrack::clear (bool onright, PlateauPool &pool)
 {
-  if (onright)
+  std::vector<CTrackSection *> &secs = (onright ? rights : lefts);
+  if (secs.front()->getScanCount () != 0)
   {
-    if (rights.front()->getScanCount () != 0)
+    bool rev = secs.back()->isReversed ();
+    std::vector<CTrackSection *>::iterator it = secs.begin ();
+    (*it++)->release (pool);
+    while (it != secs.end ())
     {
-      bool rev = curright->isReversed ();
-      std::vector<CTrackSection *>::iterator it = rights.begin ();
-      while (it != rights.end ()) delete *it++;
-      rights.clear ();
-      curright = new CTrackSection ();
-      curright->setReversed (rev);
-      rights.push_back (curright);
-    }
-  }
-  else
-  {
-    if (lefts.front()->getScanCount () != 0)
-    {
-      bool rev = curleft->isReversed ();
-      std::vector<CTrackSection *>::iterator it = lefts.begin ();
-      while (it != lefts.end ()) delete *it++;
-      lefts.clear ();
-      curleft = new CTrackSection ();
-      curleft->setReversed (rev);
-      lefts.push_back (curleft);
+      (*it)->release (pool);
+      delete *it++;
     }
+    secs.resize (1);
+    secs.front()->setReversed (rev);
+    if (onright) curright = secs.front ();
+    else curleft = secs.front ();
   }
 }
 
 
+void CarriageTrack::release (PlateauPool &pool)
+{
+  startsec.release (pool);
+  std::vector<CTrackSection *>::iterator it = rights.begin ();
+  while (it != rights.end ()) (*it++)->release (pool);
+  it = lefts.begin ();
+  while (it != lefts.end ()) (*it++)->release (pool);
+}
+
+
 void CarriageTrack::setDetectionSeed (Pt2i p1, Pt2i p2, float cs)
 {
   seed_p1.set (p1);
@@ -97,6 +96,19 @@ void CarriageTrack::setDetectionSeed (Pt2i p1, Pt2i p2, float cs)
 }
 
 
+void CarriageTrack::start (Plateau *pl, bool reversed)
+{
+  startsec.setReversed (reversed);
+  startsec.add (pl);
+  curright = new CTrackSection ();
+  curright->setReversed (reversed);
+  rights.push_back (curright);
+  curleft = new CTrackSection ();
+  curleft->setReversed (reversed);
+  lefts.push_back (curleft);
+}
+
+
 void CarriageTrack::start (Plateau *pl, const std::vector<Pt2i> &dispix,
                            bool reversed)
 {
@@ -125,6 +137,13 @@ void CarriageTrack::start (Plateau *pl, const std::vector<Pt2i> &dispix,
 }
 
 
+void CarriageTrack::add (bool onright, Plateau *pl)
+{
+  if (onright) curright->add (pl);
+  else curleft->add (pl);
+}
+
+
 void CarriageTrack::add (bool onright, Plateau *pl,
                          const std::vector<Pt2i> &dispix)
 {
@@ -287,7 +306,7 @@ bool CarriageTrack::isScanReversed (int num) const
 }
 
 
-std::vector<Pt2i> *CarriageTrack::getDisplayScan (int num)
+const Pt2i *CarriageTrack::getDisplayScan (int num, int &size)
 {
   if (num < 0)
   {
@@ -298,7 +317,7 @@ std::vector<Pt2i> *CarriageTrack::getDisplayScan (int num)
       num -= rights[scan]->getScanCount ();
       scan ++;
     }
-    return (rights[scan]->getDisplayScan (num));
+    return (rights[scan]->getDisplayScan (num, size));
   }
   else if (num > 0)
   {
@@ -309,9 +328,9 @@ std::vector<Pt2i> *CarriageTrack::getDisplayScan (int num)
       num -= lefts[scan]->getScanCount ();
       scan ++;
     }
-    return (lefts[scan]->getDisplayScan (num));
+    return (lefts[scan]->getDisplayScan (num, size));
   }
-  else return (startsec.getDisplayScan (0));
+  else return (startsec.getDisplayScan (0, size));
 }
 
 
@@ -363,7 +382,8 @@ void CarriageTrack::getPoints (std::vector<Pt2i> *pts, bool acc,
 {
   ScannerProvider sp;
   sp.setSize (imw, imh);
-  DirectionalScanner *ds = sp.getScanner (seed_p1, seed_p2, true);
+  StripScanner ds;
+  sp.setScanner (ds, seed_p1, seed_p2, true);
   bool rev = sp.isLastScanReversed ();
   Vr2i seed (seed_p1.vectorTo (seed_p2));
   int a = seed.x (), b = seed.y ();
@@ -379,16 +399,16 @@ void CarriageTrack::getPoints (std::vector<Pt2i> *pts, bool acc,
 
   std::vector<Pt2i> pix;
   std::vector<Pt2i>::iterator pit;
-  ds->first (pix);
+  ds.first (pix);
   int i = 0;
   do
   {
     Plateau *pl = plateau (i);
     if (i != 0)
     {
-      ds->bindTo (a, b, pl->scanShift ());
-      if ((i > 0 && rev) || (i < 0 && ! rev)) ds->nextOnRight (pix);
-      else ds->nextOnLeft (pix);
+      ds.bindTo (a, b, pl->scanShift ());
+      if ((i > 0 && rev) || (i < 0 && ! rev)) ds.nextOnRight (pix);
+      else ds.nextOnLeft (pix);
     }
     if (pl != NULL && pl->inserted (acc))
     {
@@ -418,37 +438,38 @@ void CarriageTrack::getPoints (std::vector<Pt2i> *pts, bool acc,
 }
 
 
-void CarriageTrack::getPoints (std::vector<std::vector<Pt2i> > *pts, bool acc,
+void CarriageTrack::getPoints (CTrackSpans *pts, bool acc,
                                int imw, int imh, float iratio)
 {
   ScannerProvider sp;
   sp.setSize (imw, imh);
-  DirectionalScanner *ds = sp.getScanner (seed_p1, seed_p2, true);
+  StripScanner ds;
+  sp.setScanner (ds, seed_p1, seed_p2, true);
   bool rev = sp.isLastScanReversed ();
   Vr2i seed (seed_p1.vectorTo (seed_p2));
   Vr2i ssdir (seed);
   if (ssdir.x () < 0) ssdir.invert ();
   float l12 = (float) (sqrt (seed.norm2 ()));
+  pts->clear (seed.x () * seed.x () >= seed.y () * seed.y ());
   Vr2f p12n (seed.x () / l12, seed.y () / l12);
   int mini = - getRightScanCount ();
   int maxi = getLeftScanCount ();
 
   std::vector<Pt2i> pix;
   std::vector<Pt2i>::iterator pit;
-  ds->first (pix);
+  ds.first (pix);
   int i = 0;
   do
   {
     Plateau *pl = plateau (i);
     if (i != 0)
     {
-      ds->bindTo (ssdir.x (), ssdir.y (), pl->scanShift ());
-      if ((i > 0 && rev) || (i < 0 && ! rev)) ds->nextOnRight (pix);
-      else ds->nextOnLeft (pix);
+      ds.bindTo (ssdir.x (), ssdir.y (), pl->scanShift ());
+      if ((i > 0 && rev) || (i < 0 && ! rev)) ds.nextOnRight (pix);
+      else ds.nextOnLeft (pix);
     }
     if (pl != NULL && pl->inserted (acc))
     {
-      std::vector<Pt2i> line;
       float sint = pl->internalStart () * iratio;
       float eint = pl->internalEnd () * iratio;
       bool cherche = (sint < eint), in = false;
@@ -464,10 +485,9 @@ void CarriageTrack::getPoints (std::vector<std::vector<Pt2i> > *pts, bool acc,
         {
           if ((rev && dist < sint) || ((! rev) && dist >= eint))
             cherche = false;
-          else line.push_back (*pit);
+          else pts->add (*pit);
         }
       }
-      pts->push_back (line);
     }
     if (i == maxi) i = -1;
     else i += (i < 0 ? -1 : 1);
@@ -481,7 +501,8 @@ void CarriageTrack::getConnectedPoints (std::vector<Pt2i> *pts, bool acc,
 {
   ScannerProvider sp;
   sp.setSize (imw, imh);
-  DirectionalScanner *ds = sp.getScanner (seed_p1, seed_p2, true);
+  StripScanner ds;
+  sp.setScanner (ds, seed_p1, seed_p2, true);
   bool rev = sp.isLastScanReversed ();
   Vr2i seed (seed_p1.vectorTo (seed_p2));
   int a = seed.x (), b = seed.y ();
@@ -500,7 +521,7 @@ void CarriageTrack::getConnectedPoints (std::vector<Pt2i> *pts, bool acc,
   float sini = 0.0, eini = 0.0f, sdif = 0.0f, edif = 0.0f;
   std::vector<Pt2i> pix;
   std::vector<Pt2i>::iterator pit;
-  ds->first (pix);
+  ds.first (pix);
   int i = 0;
   do
   {
@@ -524,9 +545,9 @@ void CarriageTrack::getConnectedPoints (std::vector<Pt2i> *pts, bool acc,
         if (i != 0)
         {
           Plateau *spl = plateau (i + (i < 0 ? lacks : - lacks));
-          ds->bindTo (a, b, spl->scanShift ());
-          if ((i > 0 && rev) || (i < 0 && ! rev)) ds->nextOnRight (pix);
-          else ds->nextOnLeft (pix);
+          ds.bindTo (a, b, spl->scanShift ());
+          if ((i > 0 && rev) || (i < 0 && ! rev)) ds.nextOnRight (pix);
+          else ds.nextOnLeft (pix);
         }
         for (pit = pix.begin (); cherche && pit != pix.end (); pit ++)
         {
@@ -569,14 +590,16 @@ if ((rev && dist < sval) || ((! rev) && dist > eval))
 }
 
 
-void CarriageTrack::getConnectedPoints (std::vector<std::vector<Pt2i> > *pts,
-                                     bool acc, int imw, int imh, float iratio)
+void CarriageTrack::getConnectedPoints (CTrackSpans *pts, bool acc,
+                                        int imw, int imh, float iratio)
 {
   int i = 0, lacks = 0, flacks = -1, blacks = -1;
   float slast = 0.0f, elast = 0.0f;
   float sint = 0.0f, eint = 0.0f, sdif = 0.0f, edif = 0.0f;
   int mini = - getRightScanCount ();
   int maxi = getLeftScanCount ();
+  Vr2i seed (seed_p1.vectorTo (seed_p2));
+  pts->clear (seed.x () * seed.x () >= seed.y () * seed.y ());
   for (int j = 0; flacks < 0 && j <= maxi; j++)
     if (plateau(j)->inserted (acc)) flacks = j;
   for (int j = 0; blacks < 0 && j >= mini; j--)
@@ -597,19 +620,19 @@ void CarriageTrack::getConnectedPoints (std::vector<std::vector<Pt2i> > *pts,
 
   ScannerProvider sp;
   sp.setSize (imw, imh);
-  DirectionalScanner *ds = sp.getScanner (seed_p1, seed_p2, true);
+  StripScanner ds;
+  sp.setScanner (ds, seed_p1, seed_p2, true);
   bool rev = sp.isLastScanReversed ();
   if (blacks == -1)
   {
-    if (rev) ds->skipRight (flacks);
-    else ds->skipLeft (flacks);
+    if (rev) ds.skipRight (flacks);
+    else ds.skipLeft (flacks);
   }
   else if (flacks == -1)
   {
-    if (rev) ds->skipLeft (blacks);
-    else ds->skipRight (blacks);
+    if (rev) ds.skipLeft (blacks);
+    else ds.skipRight (blacks);
   }
-  Vr2i seed (seed_p1.vectorTo (seed_p2));
   int a = seed.x (), b = seed.y ();
   if (a < 0.)
   {
@@ -638,17 +661,16 @@ void CarriageTrack::getConnectedPoints (std::vector<std::vector<Pt2i> > *pts,
       while (lacks)
       {
         lacks --;
-        std::vector<Pt2i> line;
         bool cherche = true, in = false;
         float sval = sint + sdif * lacks;
         float eval = eint + edif * lacks;
         int cur = i + (i < 0 ? lacks : - lacks);
-        if (cur == 0) ds->first (pix);
+        if (cur == 0) ds.first (pix);
         else
         {
-          ds->bindTo (a, b, plateau (cur)->scanShift ());
-          if ((i > 0 && rev) || (i < 0 && ! rev)) ds->nextOnRight (pix);
-          else ds->nextOnLeft (pix);
+          ds.bindTo (a, b, plateau (cur)->scanShift ());
+          if ((i > 0 && rev) || (i < 0 && ! rev)) ds.nextOnRight (pix);
+          else ds.nextOnLeft (pix);
         }
         for (pit = pix.begin (); cherche && pit != pix.end (); pit ++)
         {
@@ -664,10 +686,9 @@ if ((rev && dist <= eval) || ((! rev) && dist >= sval)) in = true;
 //            if ((rev && dist < sval) || ((! rev) && dist >= eval))
 if ((rev && dist < sval) || ((! rev) && dist > eval))
               cherche = false;
-            else line.push_back (*pit);
+            else pts->add (*pit);
           }
         }
-        pts->push_back (line);
       }
       slast = sint;
       elast = eint;
@@ -681,7 +702,6 @@ if ((rev && dist < sval) || ((! rev) && dist > eval))
       lacks = (flacks > 0 ? blacks + flacks - 1 : 0);
       slast = plateau(-blacks)->internalStart () * iratio;
       elast = plateau(-blacks)->internalEnd () * iratio;
-      std::reverse (pts->begin (), pts->end ());
     }
     else i += (i <= 0 ? -1 : 1);
   }
@@ -783,9 +803,10 @@ void CarriageTrack::addPlateauCenter (std::vector<Pt2i> &pt, int num, bool rev,
   {
     int sdraw = -1, snum = 0;
     float sint = (pl->internalStart () + pl->internalEnd ()) * iratio / 2;
-    std::vector<Pt2i>* scan = getDisplayScan (num);
-    std::vector<Pt2i>::const_iterator it = scan->begin ();
-    while (it != scan->end ())
+    int size = 0;
+    const Pt2i *scan = getDisplayScan (num, size);
+    const Pt2i *it = scan;
+    while (it != scan + size)
     {
       Vr2i p1x = pp1.vectorTo (*it);
       float dist = (p12.x () * p1x.x () + p12.y () * p1x.y ()) / l12;
@@ -800,8 +821,8 @@ void CarriageTrack::addPlateauCenter (std::vector<Pt2i> &pt, int num, bool rev,
       snum ++;
       it ++;
     }
-    if (sdraw == -1) sdraw = (int) (scan->size ()) - 1;
-    pt.push_back ((*scan)[sdraw]);
+    if (sdraw == -1) sdraw = size - 1;
+    pt.push_back (scan[sdraw]);
   }
 }
 
@@ -816,9 +837,10 @@ void CarriageTrack::addPlateauBounds (
     int sdraw = -1, edraw = -1, snum = 0;
     float sint = pl->internalStart () * iratio;
     float eint = pl->internalEnd () * iratio;
-    std::vector<Pt2i>* scan = getDisplayScan (num);
-    std::vector<Pt2i>::const_iterator it = scan->begin ();
-    while (it != scan->end ())
+    int size = 0;
+    const Pt2i *scan = getDisplayScan (num, size);
+    const Pt2i *it = scan;
+    while (it != scan + size)
     {
       Vr2i p1x = pp1.vectorTo (*it);
       float dist = (p12.x () * p1x.x () + p12.y () * p1x.y ()) / l12;
@@ -835,9 +857,9 @@ void CarriageTrack::addPlateauBounds (
       snum ++;
       it ++;
     }
-    if (sdraw == -1) sdraw = (int) (scan->size ()) - 1;
-    if (edraw == -1) edraw = (int) (scan->size ()) - 1;
-    spt.push_back ((*scan)[sdraw]);
-    ept.push_back ((*scan)[edraw]);
+    if (sdraw == -1) sdraw = size - 1;
+    if (edraw == -1) edraw = size - 1;
+    spt.push_back (scan[sdraw]);
+    ept.push_back (scan[edraw]);
   }
 }
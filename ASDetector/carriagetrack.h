@@ -23,6 +23,7 @@
 #define CARRIAGE_TRACK_H
 
 #include "ctracksection.h"
+#include "ctrackspans.h"
 
 // Display modes
 #define CTRACK_DISP_SCANS 0
@@ -59,8 +60,16 @@ public:
 
   /**
    * \brief Clears right or left sections.
+   * @param onright Indicates whether right sections are cleared.
+   * @param pool Pool to give the cleared plateaux back to.
    */
-  void clear (bool onright);
+  void clear (bool onright, PlateauPool &pool);
+
+  /**
+   * \brief Gives all the plateaux back to a pool before deletion.
+   * @param pool Plateau pool.
+   */
+  void release (PlateauPool &pool);
 
   /**
    * \brief Returns whether the carriage track was successfully detected.
@@ -95,6 +104,14 @@ public:
    */
   inline Pt2i getSeedEnd () const { return seed_p2; }
 
+  /**
+   * \brief Starts the carriage track with a central plateau only.
+   * Display scans are then not available for the whole track.
+   * @param pl Central plateau to be added.
+   * @param reversed Reversed scan modality (P2 -> P1).
+   */
+  void start (Plateau *pl, bool reversed);
+
   /**
    * \brief Starts the carriage track with a central plateau and displayed scan.
    * @param pl Central plateau to be added.
@@ -113,6 +130,13 @@ public:
   void start (Plateau *pl, const std::vector<Pt2i> &dispix,
               const std::vector<Pt2f> &pts, bool reversed);
 
+  /**
+   * \brief Adds a plateau to the track section without displayed scan.
+   * @param onright Indicates if adding deals with right section.
+   * @param pl Plateau to be added.
+   */
+  void add (bool onright, Plateau *pl);
+
   /**
    * \brief Adds a plateau to the track section and displayed scan.
    * @param onright Indicates if adding deals with right section.
@@ -153,10 +177,11 @@ public:
   bool isScanReversed (int num) const;
 
   /**
-   * \brief Returns a pointer to a scan to be displayed.
+   * \brief Returns a pointer to the first pixel of a scan to be displayed.
    * @param num plateau number.
+   * @param size Count of pixels of the scan to be set.
    */
-  std::vector<Pt2i> *getDisplayScan (int num);
+  const Pt2i *getDisplayScan (int num, int &size);
 
   /**
    * \brief Returns one of the carriage track plateaux.
@@ -204,14 +229,14 @@ public:
                   int imw, int imh, float iratio);
 
   /**
-   * \brief Fills a vector with all the carriage track points for each plateau.
-   * @param pts Pointer to a vector to fill with carriage track point lines.
+   * \brief Rasterizes all the carriage track points as pixel runs.
+   * @param pts Pointer to the runs to set.
    * @param acc Plateau acceptation modality.
    * @param imw Detection image width.
    * @param imh Detection image height.
    * @param iratio Image to meter ratio : inverse of cell size.
    */
-  void getPoints (std::vector<std::vector<Pt2i> > *pts, bool acc,
+  void getPoints (CTrackSpans *pts, bool acc,
                   int imw, int imh, float iratio);
 
   /**
@@ -226,15 +251,15 @@ public:
                            int imw, int imh, float iratio);
 
   /**
-   * \brief Returns the connected carriage track points for each plateau.
-   * @param pts Pointer to a vector to fill with carriage track point lines.
+   * \brief Rasterizes the connected carriage track points as pixel runs.
+   * @param pts Pointer to the runs to set.
    * @param acc Plateau acceptation modality.
    * @param imw Detection image width.
    * @param imh Detection image height.
    * @param iratio Image to meter ratio : inverse of cell size.
    */
-  void getConnectedPoints (std::vector<std::vector<Pt2i> > *pts,
-                           bool acc, int imw, int imh, float iratio);
+  void getConnectedPoints (CTrackSpans *pts, bool acc,
+                           int imw, int imh, float iratio);
 
   /**
    * \brief Prunes track tails plateaux.
@@ -273,6 +298,7 @@ public:
    * \brief Adds plateau positions to given vectors.
    * The plateau position is an estimate of summit or center point.
    * The second vector is used for the end positions of intervals (start / end).
+   * Nothing is added if display scans were not recorded.
    * @param pts Vector to complete with plateau positions (or start positions).
    * @param pts2 Vector to complete with plateau interval end positions.
    * @param disp Display style.
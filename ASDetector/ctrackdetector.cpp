@@ -56,6 +56,7 @@ CTrackDetector::CTrackDetector ()
   connect_on = false;
   ptset = NULL;
   profileRecordOn = false;
+  displayRecordOn = true;
   plateau_lack_tolerance = DEFAULT_PLATEAU_LACK_TOLERANCE;
   initial_track_extent = INITIAL_TRACK_EXTENT; // direction precalculation on
   density_insensitive = false;
@@ -85,6 +86,8 @@ CTrackDetector::CTrackDetector ()
   spok = new bool[unstab_nb];
   epok = new bool[unstab_nb];
   resetRegisters ();
+  trial_shifts = new float[NB_SIDE_TRIALS * 2];
+  trial_starts = new int[NB_SIDE_TRIALS * 2 + 1];
   out_count = 0;
 }
 
@@ -92,15 +95,25 @@ CTrackDetector::CTrackDetector ()
 CTrackDetector::~CTrackDetector ()
 {
   clear ();
+  delete [] trial_shifts;
+  delete [] trial_starts;
 }
 
 
 void CTrackDetector::clear ()
 {
-  if (fct != NULL) delete fct;
+  if (fct != NULL)
+  {
+    fct->release (plpool);
+    delete fct;
+  }
   fct = NULL;
   fstatus = RESULT_NONE;
-  if (ict != NULL) delete ict;
+  if (ict != NULL)
+  {
+    ict->release (plpool);
+    delete ict;
+  }
   ict = NULL;
   istatus = RESULT_NONE;
 }
@@ -210,6 +223,7 @@ CarriageTrack *CTrackDetector::detect (const Pt2i &p1, const Pt2i &p2)
       alignInput (pc);
 
       // redetection using aligned stroke
+      //   (new scanners and projection : former scans can not be reused)
       detect (0);
     }
   }
@@ -250,63 +264,54 @@ void CTrackDetector::detect (int exlimit)
   int scan0_shift = (int) (valc < 0.0f ? valc - 0.5f : valc + 0.5f);
 
   // Creates adaptive directional scanners for point cloud and display
-  DirectionalScanner *ds = scanp.getScanner (
+  StripScanner ds;
+  scanp.setScanner (ds,
     Pt2i (p1.x () * subdiv + subdiv / 2, p1.y () * subdiv + subdiv / 2),
     Pt2i (p2.x () * subdiv + subdiv / 2, p2.y () * subdiv + subdiv / 2),
     true);
-  ds->releaseClearance ();
-  DirectionalScanner *disp = discanp.getScanner (p1, p2, true);
+  ds.releaseClearance ();
+  StripScanner disp;
+  discanp.setScanner (disp, p1, p2, true);
 
   // Gets the central scan of the point cloud
   std::vector<Pt2i> pix;
-  int nbp = ds->first (pix);
+  int nbp = ds.first (pix);
   for (int i = 0; nbp != 0 && i < subdiv / 2; i++)
-    nbp = ds->nextOnRight (pix);
+    nbp = ds.nextOnRight (pix);
   nbp = 1;
   for (int i = 0; nbp != 0 && i < subdiv - 1 - subdiv / 2; i++)
-    nbp = ds->nextOnLeft (pix);
+    nbp = ds.nextOnLeft (pix);
   if (pix.empty ())
   {
     if (exlimit != 0)
       istatus = RESULT_FAIL_NO_AVAILABLE_SCAN;
     else fstatus = RESULT_FAIL_NO_AVAILABLE_SCAN;
-    delete ds;
-    delete disp;
     return;
   }
 
   // Gets the central scan for display
-  std::vector<Pt2i> dispix;
-  disp->first (dispix);
+  std::vector<Pt2i> &dispix = scan_dispix;
+  dispix.clear ();
+  disp.first (dispix);
 
   // Gets and sorts scanned points by distance to first stroke point
-  std::vector<Pt2f> cpts;
-  std::vector<Pt2i>::iterator it = pix.begin ();
-  while (it != pix.end ())
-  {
-    std::vector<Pt3f> ptcl;
-    if (! ptset->collectPoints (ptcl, it->x (), it->y ())) out_count ++;
-    std::vector<Pt3f>::iterator pit = ptcl.begin ();
-    while (pit != ptcl.end ())
-    {
-      Vr2f pcl (pit->x () - p1f.x (), pit->y () - p1f.y ());
-      cpts.push_back (Pt2f (pcl.scalarProduct (p12) / l12, pit->z ()));
-      pit ++;
-    }
-    it ++;
-  }
-  sort (cpts.begin (), cpts.end (), compIFurther);
+  strip.clear ();
+  for (std::vector<Pt2i>::iterator it = pix.begin (); it != pix.end (); it++)
+    strip.add (it->x (), it->y ());
+  strip.closeScan ();
+  std::vector<Pt2f> &cpts = scan_pts;
+  out_count += collectSortedPoints (cpts, p1f, p12, l12);
 
   // Detects the central plateau
   CarriageTrack *ct = new CarriageTrack ();
   ct->setDetectionSeed (p1, p2, csize);
   if (exlimit != 0) ict = ct;
   else fct = ct;
-  Plateau *cpl = new Plateau (&pfeat, scan0_shift);
+  Plateau *cpl = plpool.create (&pfeat, scan0_shift);
   bool success = cpl->detect (cpts);
   if ((! success) && (! cpl->noOptimalHeight ()))
   {
-    Plateau *cpl2 = new Plateau (&pfeat, scan0_shift);
+    Plateau *cpl2 = plpool.create (&pfeat, scan0_shift);
     success = cpl2->detect (cpts, false, cpl->getMinHeight ());
     if (success)
     {
@@ -319,19 +324,21 @@ void CTrackDetector::detect (int exlimit)
           && dw <= dw2)
       {
         cpl->acceptResult ();
-        delete cpl2;
+        plpool.release (cpl2);
       }
       else
       {
-        delete cpl;
+        plpool.release (cpl);
         cpl = cpl2;
       }
     }
-    else delete cpl2;
+    else plpool.release (cpl2);
   }
   if (profileRecordOn) ct->start (cpl, dispix, cpts,
                                   scanp.isLastScanReversed ());
-  else ct->start (cpl, dispix, scanp.isLastScanReversed ());
+  else if (displayRecordOn)
+    ct->start (cpl, dispix, scanp.isLastScanReversed ());
+  else ct->start (cpl, scanp.isLastScanReversed ());
   if (success) ct->accept (0);
   else
   {
@@ -339,8 +346,6 @@ void CTrackDetector::detect (int exlimit)
     if (exlimit != 0)
       istatus = RESULT_FAIL_NO_CENTRAL_PLATEAU;
     else fstatus = RESULT_FAIL_NO_CENTRAL_PLATEAU;
-    delete ds;
-    delete disp;
     return;
   }
 
@@ -349,8 +354,8 @@ void CTrackDetector::detect (int exlimit)
   initial_refs = cpl->internalStart ();
   initial_refe = cpl->internalEnd ();
   initial_refh = cpl->getMinHeight ();
-  DirectionalScanner *ds2 = ds->getCopy ();
-  DirectionalScanner *disp2 = disp->getCopy ();
+  StripScanner ds2 (ds);
+  StripScanner disp2 (disp);
 
   resetRegisters (cpl->reliable (),
                   cpl->estimatedCenter (), cpl->getMinHeight ());
@@ -365,6 +370,8 @@ void CTrackDetector::detect (int exlimit)
 
   // second chance for first side if the central plateau was not bounded
   //   and a bound was found on the second side.
+  // The first side scanner is not rewound : scanning resumes after the
+  //   scans of the first trial, so that no scan is collected twice.
   if (firstUnbounded && ! initial_unbounded)
   {
     resetRegisters (cpl->reliable (),
@@ -379,8 +386,6 @@ void CTrackDetector::detect (int exlimit)
     if (exlimit != 0) istatus = RESULT_FAIL_NO_CONSISTENT_SEQUENCE;
     else fstatus = RESULT_FAIL_NO_CONSISTENT_SEQUENCE;
   }
-  delete ds;
-  delete disp;
 }
 
 
@@ -399,82 +404,92 @@ void CTrackDetector::detect ()
   int scan0_shift = (int) (valc < 0.0f ? valc - 0.5f : valc + 0.5f);
 
   // Creates adaptive directional scanners for point cloud and display
-  DirectionalScanner *ds = scanp.getScanner (
+  StripScanner ds;
+  scanp.setScanner (ds,
     Pt2i (p1.x () * subdiv + subdiv / 2, p1.y () * subdiv + subdiv / 2),
     Pt2i (p2.x () * subdiv + subdiv / 2, p2.y () * subdiv + subdiv / 2),
     true);
-  ds->releaseClearance ();
-  DirectionalScanner *disp = discanp.getScanner (p1, p2, true);
+  ds.releaseClearance ();
+  StripScanner disp;
+  discanp.setScanner (disp, p1, p2, true);
 
   // Gets the central scan of the point cloud
   std::vector<Pt2i> pix;
-  int nbp = ds->first (pix);
+  int nbp = ds.first (pix);
   for (int i = 0; nbp != 0 && i < subdiv / 2; i++)
-    nbp = ds->nextOnRight (pix);
+    nbp = ds.nextOnRight (pix);
   nbp = 1;
   for (int i = 0; nbp != 0 && i < subdiv - 1 - subdiv / 2; i++)
-    nbp = ds->nextOnLeft (pix);
+    nbp = ds.nextOnLeft (pix);
   if (pix.empty ())
   {
     fstatus = RESULT_FAIL_NO_AVAILABLE_SCAN;
-    delete ds;
-    delete disp;
     return;
   }
 
   // Gets the central scan for display
-  std::vector<Pt2i> dispix;
-  disp->first (dispix);
+  std::vector<Pt2i> &dispix = scan_dispix;
+  dispix.clear ();
+  disp.first (dispix);
 
   // Gets and sorts scanned points by distance to first stroke point
-  std::vector<Pt2f> cpts;
-  std::vector<Pt2i>::iterator it = pix.begin ();
-  while (it != pix.end ())
-  {
-    std::vector<Pt3f> ptcl;
-    if (! ptset->collectPoints (ptcl, it->x (), it->y ())) out_count ++;
-    std::vector<Pt3f>::iterator pit = ptcl.begin ();
-    while (pit != ptcl.end ())
-    {
-      Vr2f pcl (pit->x () - p1f.x (), pit->y () - p1f.y ());
-      cpts.push_back (Pt2f (pcl.scalarProduct (p12) / l12, pit->z ()));
-      pit ++;
-    }
-    it ++;
-  }
-  sort (cpts.begin (), cpts.end (), compIFurther);
+  strip.clear ();
+  for (std::vector<Pt2i>::iterator it = pix.begin (); it != pix.end (); it++)
+    strip.add (it->x (), it->y ());
+  strip.closeScan ();
+  std::vector<Pt2f> &cpts = scan_pts;
+  out_count += collectSortedPoints (cpts, p1f, p12, l12);
+  Plateau::toMillimeters (cpts, scan_ipts);
 
   // Creates the carriage track
   fct = new CarriageTrack ();
   fct->setDetectionSeed (p1, p2, csize);
 
-  float *tests = new float[NB_SIDE_TRIALS * 2];
+  float *tests = trial_shifts;
   for (int i = 0; i < NB_SIDE_TRIALS; i ++)
   {
     tests[2 * i] = pfeat.firstPlateauSearchDistance () * (i + 1);
     tests[2 * i + 1] = - pfeat.firstPlateauSearchDistance () * (i + 1);
   }
-  Plateau *cpl = new Plateau (&pfeat, scan0_shift);
+  Plateau *cpl = plpool.create (&pfeat, scan0_shift);
   bool found = (pfeat.isNetBuildOn () ?
-    cpl->track (cpts, NULL, 0, 0.0f, l12) :
-    cpl->track (cpts, 0.0f, l12, 0.0f, 0.0f, 0));
-  for (int ptest = 0; ptest != NB_SIDE_TRIALS * 2; ptest++)
+    cpl->track (cpts, scan_ipts, NULL, 0, 0.0f, l12) :
+    cpl->track (cpts, scan_ipts, 0.0f, l12, 0.0f, 0.0f, 0));
+
+  // Side trials fail as the central one on too short scans.
+  // Side trials from an already tried start point give the same plateau,
+  //   which can not be thiner than the retained one
+  int nbtests = ((int) (cpts.size ()) < pfeat.minCountOfPoints () ?
+                 0 : NB_SIDE_TRIALS * 2);
+  int *starts = trial_starts;
+  int nbstarts = 0;
+  starts[nbstarts++] = cpl->firstStartIndex (scan_ipts, l12, 0.0f);
+  for (int ptest = 0; ptest != nbtests; ptest++)
   {
-    Plateau *cpl2 = new Plateau (&pfeat, scan0_shift);
+    int st = cpl->firstStartIndex (scan_ipts, l12, tests[ptest]);
+    bool tried = false;
+    for (int i = 0; ! tried && i < nbstarts; i++)
+      if (starts[i] == st) tried = true;
+    if (tried) continue;
+    starts[nbstarts++] = st;
+
+    Plateau *cpl2 = plpool.create (&pfeat, scan0_shift);
     bool success = (pfeat.isNetBuildOn () ?
-      cpl2->track (cpts, NULL, 0, tests[ptest], l12) :
-      cpl2->track (cpts, 0.0f, l12, 0.0f, tests[ptest], 0));
+      cpl2->track (cpts, scan_ipts, NULL, 0, tests[ptest], l12) :
+      cpl2->track (cpts, scan_ipts, 0.0f, l12, 0.0f, tests[ptest], 0));
     if (success) found = true;
     if (success && cpl2->thinerThan (cpl))
     {
-      delete cpl;
+      plpool.release (cpl);
       cpl = cpl2;
     }
-    else delete cpl2;
+    else plpool.release (cpl2);
   }
   if (profileRecordOn) fct->start (cpl, dispix, cpts,
                                    scanp.isLastScanReversed ());
-  else fct->start (cpl, dispix, scanp.isLastScanReversed ());
+  else if (displayRecordOn)
+    fct->start (cpl, dispix, scanp.isLastScanReversed ());
+  else fct->start (cpl, scanp.isLastScanReversed ());
   if (pfeat.isNetBuildOn ())
   {
     if (cpl->consistentWidth ()) fct->accept (0);
@@ -484,8 +499,6 @@ void CTrackDetector::detect ()
   {
     fct->setStatus (RESULT_FAIL_NO_CENTRAL_PLATEAU);
     fstatus = RESULT_FAIL_NO_CENTRAL_PLATEAU;
-    delete ds;
-    delete disp;
     return;
   }
 
@@ -495,8 +508,8 @@ void CTrackDetector::detect ()
   initial_refs = cpl->internalStart ();
   initial_refe = cpl->internalEnd ();
   initial_refh = cpl->getMinHeight ();
-  DirectionalScanner *ds2 = ds->getCopy ();
-  DirectionalScanner *disp2 = disp->getCopy ();
+  StripScanner ds2 (ds);
+  StripScanner disp2 (disp);
 
   resetRegisters (cpl->reliable (),
                   cpl->estimatedCenter (), cpl->getMinHeight ());
@@ -516,6 +529,8 @@ void CTrackDetector::detect ()
 
   // second chance for first side if the central plateau was not bounded
   //   and a bound was found on the second side.
+  // The first side scanner is not rewound : scanning resumes after the
+  //   scans of the first trial, so that no scan is collected twice.
   if (firstUnbounded && ! initial_unbounded)
   {
     resetRegisters (cpl->reliable (),
@@ -531,13 +546,11 @@ void CTrackDetector::detect ()
     fct->setStatus (RESULT_FAIL_NO_CONSISTENT_SEQUENCE);
     fstatus = RESULT_FAIL_NO_CONSISTENT_SEQUENCE;
   }
-  delete ds;
-  delete disp;
 }
 
 
 void CTrackDetector::track (bool onright, bool reversed, int exlimit,
-                            DirectionalScanner *ds, DirectionalScanner *disp,
+                            StripScanner &ds, StripScanner &disp,
                             Pt2f p1f, Vr2f p12, float l12,
                             float refs, float refe, float refh)
 {
@@ -546,7 +559,7 @@ void CTrackDetector::track (bool onright, bool reversed, int exlimit,
   int num = (onright ? -1 : 1);
   if (onright) exlimit = - exlimit;
   CarriageTrack *ct = (exlimit != 0 ? ict : fct);
-  ct->clear (onright);
+  ct->clear (onright, plpool);
   int confdist = 1;
   Pt2i ss_p1, ss_p2;
   getInputStroke (ss_p1, ss_p2, exlimit != 0);
@@ -562,73 +575,60 @@ void CTrackDetector::track (bool onright, bool reversed, int exlimit,
     float posy = ss_p1.y () + (ss_p12.y () / ss_l12) * pcenter / csize;
     float valc = dss_n.x () * posx + dss_n.y () * posy;
     int scan_shift = (int) (valc < 0.0f ? valc - 0.5f : valc + 0.5f);
-    disp->bindTo (dss_n.x (), dss_n.y (), scan_shift);
-    ds->bindTo (dss_n.x (), dss_n.y (), scan_shift * subdiv + subdiv / 2);
+    disp.bindTo (dss_n.x (), dss_n.y (), scan_shift);
+    ds.bindTo (dss_n.x (), dss_n.y (), scan_shift * subdiv + subdiv / 2);
 
     // Collects next scan points and sorts them by distance
-    std::vector<Pt2i> pix;
-    std::vector<Pt2i> dispix;
+    std::vector<Pt2i> &dispix = scan_dispix;
+    dispix.clear ();
+    strip.clear ();
     if ((onright && ! reversed) || (reversed && ! onright))
-      disp->nextOnRight (dispix);
-    else disp->nextOnLeft (dispix);
+      disp.nextOnRight (dispix);
+    else disp.nextOnLeft (dispix);
     if (dispix.empty ()) search = false;
-    else
-      for (int i = 0; search && i < subdiv; i++)
-        if ((onright && ! reversed) || (reversed && ! onright))
-        {
-          if (ds->nextOnRight (pix) == 0) search = false;
-        }
-        else if (ds->nextOnLeft (pix) == 0) search = false;
-    if (pix.empty ()) search = false;
+    else if ((onright && ! reversed) || (reversed && ! onright))
+    {
+      if (ds.nextOnRight (strip, subdiv) == 0) search = false;
+    }
+    else if (ds.nextOnLeft (strip, subdiv) == 0) search = false;
+    if (strip.empty ()) search = false;
     else
     {
-      std::vector<Pt2f> pts;
-      std::vector<Pt2i>::iterator it = pix.begin ();
-      while (it != pix.end ())
-      {
-        std::vector<Pt3f> ptcl;
-        if (! ptset->collectPoints (ptcl, it->x (), it->y ())) out_count ++;
-        std::vector<Pt3f>::iterator pit = ptcl.begin ();
-        while (pit != ptcl.end ())
-        {
-          Vr2f pcl (pit->x () - p1f.x (), pit->y () - p1f.y ());
-          pts.push_back (Pt2f (pcl.scalarProduct (p12) / l12, pit->z ()));
-          pit ++;
-        }
-        it ++;
-      }
-      sort (pts.begin (), pts.end (), compIFurther);
+      std::vector<Pt2f> &pts = scan_pts;
+      out_count += collectSortedPoints (pts, p1f, p12, l12);
+      Plateau::toMillimeters (pts, scan_ipts);
 
       // Detects the plateau and updates the track section
-      Plateau *pl = new Plateau (&pfeat, scan_shift);
-      pl->track (pts, refs, refe, refh, 0.0f, confdist);
+      Plateau *pl = plpool.create (&pfeat, scan_shift);
+      pl->track (pts, scan_ipts, refs, refe, refh, 0.0f, confdist);
       if (pl->getStatus () != Plateau::PLATEAU_RES_OK)
       {
-        Plateau *pl2 = new Plateau (&pfeat, scan_shift);
-        pl2->track (pts, refs, refe, refh,
+        Plateau *pl2 = plpool.create (&pfeat, scan_shift);
+        pl2->track (pts, scan_ipts, refs, refe, refh,
                     pfeat.plateauSearchDistance (), confdist);
         if (pl2->getStatus () != Plateau::PLATEAU_RES_OK)
         {
-          delete pl2;
-          Plateau *pl3 = new Plateau (&pfeat, scan_shift);
-          pl3->track (pts, refs, refe, refh,
+          plpool.release (pl2);
+          Plateau *pl3 = plpool.create (&pfeat, scan_shift);
+          pl3->track (pts, scan_ipts, refs, refe, refh,
                       -pfeat.plateauSearchDistance (), confdist);
           if (pl3->getStatus () != Plateau::PLATEAU_RES_OK)
-            delete pl3;
+            plpool.release (pl3);
           else
           {
-            delete pl;
+            plpool.release (pl);
             pl = pl3;
           }
         }
         else
         {
-          delete pl;
+          plpool.release (pl);
           pl = pl2;
         }
       }
       if (profileRecordOn) ct->add (onright, pl, dispix, pts);
-      else ct->add (onright, pl, dispix);
+      else if (displayRecordOn) ct->add (onright, pl, dispix);
+      else ct->add (onright, pl);
 
       // Ends tracking after a given amount of failures (point lacks apart).
       if (pl->getStatus () == Plateau::PLATEAU_RES_OK) nbfail = 0;
@@ -703,7 +703,7 @@ void CTrackDetector::track (bool onright, bool reversed, int exlimit,
 
 // AMRELnet version
 void CTrackDetector::track (bool onright, bool reversed, int exlimit,
-                            DirectionalScanner *ds, DirectionalScanner *disp,
+                            StripScanner &ds, StripScanner &disp,
                             Pt2f p1f, Vr2f p12, float l12, Plateau *ref)
 {
   bool search = true;
@@ -711,7 +711,7 @@ void CTrackDetector::track (bool onright, bool reversed, int exlimit,
   int num = (onright ? -1 : 1);
   if (onright) exlimit = - exlimit;
   CarriageTrack *ct = (exlimit != 0 ? ict : fct);
-  ct->clear (onright);
+  ct->clear (onright, plpool);
   int confdist = 1;
   Pt2i ss_p1, ss_p2;
   getInputStroke (ss_p1, ss_p2, exlimit != 0);
@@ -727,49 +727,35 @@ void CTrackDetector::track (bool onright, bool reversed, int exlimit,
     float posy = ss_p1.y () + (ss_p12.y () / ss_l12) * pcenter / csize;
     float valc = dss_n.x () * posx + dss_n.y () * posy;
     int scan_shift = (int) (valc < 0.0f ? valc - 0.5f : valc + 0.5f);
-    disp->bindTo (dss_n.x (), dss_n.y (), scan_shift);
-    ds->bindTo (dss_n.x (), dss_n.y (), scan_shift * subdiv + subdiv / 2);
+    disp.bindTo (dss_n.x (), dss_n.y (), scan_shift);
+    ds.bindTo (dss_n.x (), dss_n.y (), scan_shift * subdiv + subdiv / 2);
 
     // Collects next scan points and sorts them by distance
-    std::vector<Pt2i> pix;
-    std::vector<Pt2i> dispix;
+    std::vector<Pt2i> &dispix = scan_dispix;
+    dispix.clear ();
+    strip.clear ();
     if ((onright && ! reversed) || (reversed && ! onright))
-      disp->nextOnRight (dispix);
-    else disp->nextOnLeft (dispix);
+      disp.nextOnRight (dispix);
+    else disp.nextOnLeft (dispix);
     if (dispix.empty ()) search = false;
-    else
-      for (int i = 0; search && i < subdiv; i++)
-        if ((onright && ! reversed) || (reversed && ! onright))
-        {
-          if (ds->nextOnRight (pix) == 0) search = false;
-        }
-        else if (ds->nextOnLeft (pix) == 0) search = false;
-    if (pix.empty ()) search = false;
+    else if ((onright && ! reversed) || (reversed && ! onright))
+    {
+      if (ds.nextOnRight (strip, subdiv) == 0) search = false;
+    }
+    else if (ds.nextOnLeft (strip, subdiv) == 0) search = false;
+    if (strip.empty ()) search = false;
     else
     {
-      std::vector<Pt2f> pts;
-      std::vector<Pt2i>::iterator it = pix.begin ();
-      while (it != pix.end ())
-      {
-        std::vector<Pt3f> ptcl;
-        if (! ptset->collectPoints (ptcl, it->x (), it->y ())) out_count ++;
-        std::vector<Pt3f>::iterator pit = ptcl.begin ();
-        while (pit != ptcl.end ())
-        {
-          Vr2f pcl (pit->x () - p1f.x (), pit->y () - p1f.y ());
-          pts.push_back (Pt2f (pcl.scalarProduct (p12) / l12, pit->z ()));
-          pit ++;
-        }
-        it ++;
-      }
+      std::vector<Pt2f> &pts = scan_pts;
+      out_count += collectSortedPoints (pts, p1f, p12, l12);
 
       // Detects the plateau and updates the track section
-      Plateau *pl = new Plateau (&pfeat, scan_shift);
-      sort (pts.begin (), pts.end (), compIFurther);
-      pl->track (pts, ref, confdist, 0.0f, 0.0f);
+      Plateau *pl = plpool.create (&pfeat, scan_shift);
+      Plateau::toMillimeters (pts, scan_ipts);
+      pl->track (pts, scan_ipts, ref, confdist, 0.0f, 0.0f);
       if (pl->getStatus () != Plateau::PLATEAU_RES_OK)
       {
-        float *retests = new float[NB_SIDE_TRIALS * 2];
+        float *retests = trial_shifts;
         for (int i = 0; i < NB_SIDE_TRIALS; i ++)
         {
           retests[2 * i] = pfeat.plateauSearchDistance () * (i + 1);
@@ -778,19 +764,20 @@ void CTrackDetector::track (bool onright, bool reversed, int exlimit,
         bool tracking = true;
         for (int i = 0; tracking && i < NB_SIDE_TRIALS * 2; i++)
         {
-          Plateau *pl2 = new Plateau (&pfeat, scan_shift);
-          pl2->track (pts, ref, confdist, retests[i], 0.0f);
+          Plateau *pl2 = plpool.create (&pfeat, scan_shift);
+          pl2->track (pts, scan_ipts, ref, confdist, retests[i], 0.0f);
           if (pl2->getStatus () > pl->getStatus ())
           {
-            delete pl;
+            plpool.release (pl);
             pl = pl2;
             if (pl->getStatus () == Plateau::PLATEAU_RES_OK) tracking = false;
           }
-          else delete pl2;
+          else plpool.release (pl2);
         }
       }
       if (profileRecordOn) ct->add (onright, pl, dispix, pts);
-      else ct->add (onright, pl, dispix);
+      else if (displayRecordOn) ct->add (onright, pl, dispix);
+      else ct->add (onright, pl);
 
       // Ends tracking when meeting an obstacle.
       if (pfeat.isNetBuildOn () && pl->impassable ()) search = false;
@@ -1045,6 +1032,25 @@ int CTrackDetector::boundsStability (float slast, float elast,
 }
 
 
+int CTrackDetector::collectSortedPoints (std::vector<Pt2f> &pts,
+                                         Pt2f p1f, Vr2f p12, float l12)
+{
+  int nbout = 0;
+  pts.clear ();
+  sorter.clear ();
+  for (int k = 0; k < strip.countOfScans (); k++)
+  {
+    nbout += ptset->collectProjectedPoints (pts,
+                    strip.xData () + strip.start (k),
+                    strip.yData () + strip.start (k),
+                    strip.end (k) - strip.start (k), p1f, p12, l12);
+    sorter.closeRun ((int) (pts.size ()));
+  }
+  sorter.sort (pts);
+  return nbout;
+}
+
+
 bool CTrackDetector::compIFurther (Pt2f p1, Pt2f p2)
 {
   return (floor (p2.x () * 1000) > floor (p1.x () * 1000)
@@ -1227,19 +1233,20 @@ void CTrackDetector::labelPoints (CarriageTrack *ct)
     a = -a;
     b = -b;
   }
-  DirectionalScanner *ds = scanp.getScanner (
+  StripScanner ds;
+  scanp.setScanner (ds,
     Pt2i (ctp1.x () * subdiv + subdiv / 2, ctp1.y () * subdiv + subdiv / 2),
     Pt2i (ctp2.x () * subdiv + subdiv / 2, ctp2.y () * subdiv + subdiv / 2),
     true);
-  ds->releaseClearance ();
+  ds.releaseClearance ();
 
   std::vector<Pt2i> pix0;
-  int nbp = ds->first (pix0);
+  int nbp = ds.first (pix0);
   for (int i = 0; nbp != 0 && i < subdiv / 2; i++)
-    nbp = ds->nextOnRight (pix0);
+    nbp = ds.nextOnRight (pix0);
   nbp = 1;
   for (int i = 0; nbp != 0 && i < subdiv - 1 - subdiv / 2; i++)
-    nbp = ds->nextOnLeft (pix0);
+    nbp = ds.nextOnLeft (pix0);
 
   Plateau *pl = ct->plateau (0);
   if (pl->isAccepted ())
@@ -1282,14 +1289,14 @@ void CTrackDetector::labelPoints (CarriageTrack *ct)
   for (int i = -1; i >= - ct->getRightScanCount (); i--)
   {
     Plateau *pl = ct->plateau (i);
-    ds->bindTo (a, b, pl->scanShift () * subdiv + subdiv / 2);
+    ds.bindTo (a, b, pl->scanShift () * subdiv + subdiv / 2);
     std::vector<Pt2i> pix;
     for (int i = 0; search && i < subdiv; i++)
       if (scanp.isLastScanReversed ())
       {
-        if (ds->nextOnLeft (pix) == 0) search = false;
+        if (ds.nextOnLeft (pix) == 0) search = false;
       }
-      else if (ds->nextOnRight (pix) == 0) search = false;
+      else if (ds.nextOnRight (pix) == 0) search = false;
 
     if (pl->isAccepted ())
     {
@@ -1332,14 +1339,14 @@ void CTrackDetector::labelPoints (CarriageTrack *ct)
   for (int i = 1; i <= ct->getLeftScanCount (); i++)
   {
     Plateau *pl = ct->plateau (i);
-    ds->bindTo (a, b, pl->scanShift () * subdiv + subdiv / 2);
+    ds.bindTo (a, b, pl->scanShift () * subdiv + subdiv / 2);
     std::vector<Pt2i> pix;
     for (int i = 0; search && i < subdiv; i++)
       if (scanp.isLastScanReversed ())
       {
-        if (ds->nextOnRight (pix) == 0) search = false;
+        if (ds.nextOnRight (pix) == 0) search = false;
       }
-      else if (ds->nextOnLeft (pix) == 0) search = false;
+      else if (ds.nextOnLeft (pix) == 0) search = false;
 
     if (pl->isAccepted ())
     {
@@ -25,6 +25,7 @@
 #include "carriagetrack.h"
 #include "ipttileset.h"
 #include "scannerprovider.h"
+#include "scansorter.h"
 
 
 /** 
@@ -89,6 +90,11 @@ public:
    */
   void preserveDetection ();
 
+  /**
+   * \brief Returns the pool of released plateaux.
+   */
+  inline PlateauPool &plateauPool () { return plpool; }
+
   /**
    * \brief Returns the profile model used.
    */
@@ -162,6 +168,15 @@ public:
    */
   inline void recordProfile (bool status) { profileRecordOn = status; }
 
+  /**
+   * \brief Sets the display scan registration status on or off.
+   * Without display scans, detected carriage tracks can still be drawn
+   *   by getPoints or getConnectedPoints, but not located by getPosition.
+   * Profile registration also registers display scans.
+   * @param status New status for display scan registration modality.
+   */
+  inline void recordDisplayScans (bool status) { displayRecordOn = status; }
+
   /**
    * \brief Checks whether no successful detection is stored.
    */
@@ -284,6 +299,13 @@ inline void resetOuts () { out_count = 0; }
    */
   void labelPoints (CarriageTrack *ct);
 
+  /**
+   * \brief Compares points by distance to scan bound on integer basis.
+   * @param p1 First point.
+   * @param p2 Second point.
+   */
+  static bool compIFurther (Pt2f p1, Pt2f p2);
+
 
 private :
 
@@ -324,11 +346,25 @@ private :
   bool connect_on;
   /** Profile registration status. */
   bool profileRecordOn;
+  /** Display scan registration status. */
+  bool displayRecordOn;
 
   /** Directional scanner provider for detection purpose. */
   ScannerProvider scanp;
   /** Directional scanner provider for display purpose. */
   ScannerProvider discanp;
+  /** Scratch strip of subdivided scans, reused at each tracking step. */
+  ScanStrip strip;
+  /** Reused buffer of scanned points (distance, height). */
+  std::vector<Pt2f> scan_pts;
+  /** Reused buffer of scanned points in integer millimeters. */
+  std::vector<Pt2i> scan_ipts;
+  /** Sorter of scanned points by distance. */
+  ScanSorter sorter;
+  /** Reused buffer of scanned pixels for display. */
+  std::vector<Pt2i> scan_dispix;
+  /** Released plateaux, recycled at next plateau creation. */
+  PlateauPool plpool;
   /** Plateau detection features. */
   PlateauModel pfeat;
   /** Tolered successive failures of plateaux detection. */
@@ -393,6 +429,10 @@ private :
   bool *spok;
   /** Last end position consistency status. */
   bool *epok;
+  /** Scratch of the side trials center shifts. */
+  float *trial_shifts;
+  /** Scratch of the start indices of the tried central plateaux. */
+  int *trial_starts;
 
   int out_count;
 
@@ -423,7 +463,7 @@ private :
    * @param refh Template lower height.
    */
   void track (bool onright, bool reversed, int exlimit,
-              DirectionalScanner *ds, DirectionalScanner *disp,
+              StripScanner &ds, StripScanner &disp,
               Pt2f p1f, Vr2f p12, float l12,
               float refs, float refe, float refh);
 
@@ -442,7 +482,7 @@ private :
    * @param ref Reference plateau.
    */
   void track (bool onright, bool reversed, int exlimit,
-              DirectionalScanner *ds, DirectionalScanner *disp,
+              StripScanner &ds, StripScanner &disp,
               Pt2f p1f, Vr2f p12, float l12, Plateau *ref);
 
   /**
@@ -482,11 +522,16 @@ private :
                        bool sok, bool eok, float trw);
 
   /**
-   * \brief Compares points by distance to scan bound on integer basis.
-   * @param p1 First point.
-   * @param p2 Second point.
+   * \brief Collects the points of the scan strip sorted by distance.
+   * Each scan of the strip provides a nearly sorted run of points.
+   * Returns the count of scanned cells out of the tile set.
+   * @param pts Collected points (distance, height).
+   * @param p1f Scan origin (in meters).
+   * @param p12 Scan direction vector.
+   * @param l12 Scan direction vector length.
    */
-  static bool compIFurther (Pt2f p1, Pt2f p2);
+  int collectSortedPoints (std::vector<Pt2f> &pts,
+                           Pt2f p1f, Vr2f p12, float l12);
 
   /**
    * \brief Compares labelled points by distance to scan bound on integer basis.
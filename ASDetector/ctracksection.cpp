@@ -40,6 +40,19 @@ CTrackSection::~CTrackSection ()
 }
 
 
+void CTrackSection::release (PlateauPool &pool)
+{
+  std::vector<Plateau *>::iterator it = plateaux.begin ();
+  while (it != plateaux.end ()) pool.release (*it++);
+  plateaux.clear ();
+  points.clear ();
+  dispts.clear ();
+  disstarts.clear ();
+  last = -1;
+  holes = 0;
+}
+
+
 void CTrackSection::clearDetectionData ()
 {
   points.clear ();
@@ -47,14 +60,16 @@ void CTrackSection::clearDetectionData ()
 
 
 void CTrackSection::clearDisplayData () {
-  discans.clear ();
+  dispts.clear ();
+  disstarts.clear ();
 }
 
 
 void CTrackSection::add (Plateau *pl, const std::vector<Pt2i> &dispix)
 {
   plateaux.push_back (pl);
-  discans.push_back (dispix);
+  disstarts.push_back ((int) (dispts.size ()));
+  dispts.insert (dispts.end (), dispix.begin (), dispix.end ());
 }
 
 
@@ -62,17 +77,20 @@ void CTrackSection::add (Plateau *pl, const std::vector<Pt2i> &dispix,
                                       const std::vector<Pt2f> &pts)
 {
   plateaux.push_back (pl);
-  discans.push_back (dispix);
+  disstarts.push_back ((int) (dispts.size ()));
+  dispts.insert (dispts.end (), dispix.begin (), dispix.end ());
   points.push_back (pts);
 }
 
 
 bool CTrackSection::getScanBounds (int ind, Pt2i &p1, Pt2i &p2)
 {
-  if (discans.empty ()) return false;
-  if (ind < 0 || ind >= (int) (discans.size ())) return false;
-  p1.set (discans[ind].front ());
-  p2.set (discans[ind].back ());
+  if (ind < 0 || ind >= (int) (disstarts.size ())) return false;
+  int size = 0;
+  const Pt2i *scan = getDisplayScan (ind, size);
+  if (size == 0) return false;
+  p1.set (scan[0]);
+  p2.set (scan[size - 1]);
   return true;
 }
 
@@ -22,7 +22,7 @@
 #ifndef CARRIAGE_TRACK_SECTION_H
 #define CARRIAGE_TRACK_SECTION_H
 
-#include "plateau.h"
+#include "plateaupool.h"
 #include "pt2i.h"
 #include "pt2f.h"
 #include <cstddef>
@@ -46,6 +46,18 @@ public:
    */
   ~CTrackSection ();
 
+  /**
+   * \brief Gives the section plateaux back to a pool and empties the section.
+   * @param pool Plateau pool.
+   */
+  void release (PlateauPool &pool);
+
+  /**
+   * \brief Adds a plateau to the track section without displayed scan.
+   * @param pl Plateau to be added.
+   */
+  inline void add (Plateau *pl) { plateaux.push_back (pl); }
+
   /**
    * \brief Adds a plateau to the track section with displayed scan.
    * @param pl Plateau to be added.
@@ -83,9 +95,14 @@ public:
   float getHeightReference (int num) const;
 
   /**
-   * \brief Returns a pointer to a scan to be displayed.
+   * \brief Returns a pointer to the first pixel of a scan to be displayed.
+   * @param num Index of the scan.
+   * @param size Count of pixels of the scan to be set.
    */
-  inline std::vector<Pt2i> *getDisplayScan (int num) { return &(discans[num]); }
+  inline const Pt2i *getDisplayScan (int num, int &size) const {
+    size = (num + 1 < (int) (disstarts.size ()) ?
+            disstarts[num + 1] : (int) (dispts.size ())) - disstarts[num];
+    return (dispts.data () + disstarts[num]); }
 
   /**
    * \brief Returns a point profile to be displayed.
@@ -153,8 +170,10 @@ private :
   /** Detected plateaux. */
   std::vector<Plateau *> plateaux;
 
-  /** Image scans for display. */
-  std::vector<std::vector <Pt2i> > discans;
+  /** Pixels of all the image scans for display, stored end to end. */
+  std::vector<Pt2i> dispts;
+  /** Start index of each image scan in dispts. */
+  std::vector<int> disstarts;
   /** Image scans inversion status. */
   bool reversed;
   /** Number of last accepted plateau in the section. */
@@ -0,0 +1,50 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "ctrackspans.h"
+
+
+void CTrackSpans::add (const Pt2i &p)
+{
+  if (! starts.empty ())
+  {
+    Pt2i &s = starts.back ();
+    int &l = lengths.back ();
+    if (horizontal ? p.y () == s.y () : p.x () == s.x ())
+    {
+      int pos = (horizontal ? p.x () : p.y ());
+      int spos = (horizontal ? s.x () : s.y ());
+      if (pos == spos + l)
+      {
+        l ++;
+        return;
+      }
+      if (pos == spos - 1)
+      {
+        s.set (p);
+        l ++;
+        return;
+      }
+    }
+  }
+  starts.push_back (p);
+  lengths.push_back (1);
+}
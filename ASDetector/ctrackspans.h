@@ -0,0 +1,104 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CTRACK_SPANS_H
+#define CTRACK_SPANS_H
+
+#include <vector>
+#include "pt2i.h"
+
+
+/** 
+ * @class CTrackSpans ctrackspans.h
+ * \brief Rasterized carriage track as runs of successive pixels.
+ * Scans of a carriage track are nearly parallel to the detection seed, so
+ *   that their pixels are gathered in long runs along rows (or along
+ *   columns for mostly vertical seeds).
+ */
+class CTrackSpans
+{
+public:
+
+  /**
+   * \brief Creates an empty set of runs along rows.
+   */
+  CTrackSpans () { horizontal = true; }
+
+  /**
+   * \brief Forgets previous runs and sets the orientation of next ones.
+   * @param rows Indicates whether runs are gathered along rows.
+   */
+  inline void clear (bool rows) {
+    starts.clear ();
+    lengths.clear ();
+    horizontal = rows; }
+
+  /**
+   * \brief Exchanges the runs with those of another set.
+   * @param spans Other set of runs.
+   */
+  inline void swap (CTrackSpans &spans) {
+    starts.swap (spans.starts);
+    lengths.swap (spans.lengths);
+    bool tmp = horizontal;
+    horizontal = spans.horizontal;
+    spans.horizontal = tmp; }
+
+  /**
+   * \brief Adds a pixel, extending the last run if adjacent to it.
+   * @param p Pixel to add.
+   */
+  void add (const Pt2i &p);
+
+  /**
+   * \brief Indicates whether runs are gathered along rows.
+   */
+  inline bool alongRows () const { return horizontal; }
+
+  /**
+   * \brief Returns the count of runs.
+   */
+  inline int size () const { return ((int) (starts.size ())); }
+
+  /**
+   * \brief Returns the pixel of lowest coordinates of a run.
+   * @param i Run index.
+   */
+  inline const Pt2i &start (int i) const { return starts[i]; }
+
+  /**
+   * \brief Returns the count of pixels of a run.
+   * @param i Run index.
+   */
+  inline int length (int i) const { return lengths[i]; }
+
+
+private:
+
+  /** Runs orientation : along rows if true, along columns otherwise. */
+  bool horizontal;
+  /** Start pixels of the runs. */
+  std::vector<Pt2i> starts;
+  /** Lengths of the runs. */
+  std::vector<int> lengths;
+};
+
+#endif
@@ -41,6 +41,19 @@ const int Plateau::PLATEAU_RES_OUT_OF_HEIGHT_REF = -14;
 
 
 Plateau::Plateau (PlateauModel *pmod, int ct_shift)
+{
+  dss = NULL;
+  reset (pmod, ct_shift);
+}
+
+
+Plateau::~Plateau ()
+{
+  if (dss != NULL) delete dss;
+}
+
+
+void Plateau::reset (PlateauModel *pmod, int ct_shift)
 {
   this->pmod = pmod;
   scan_shift = ct_shift;
@@ -66,17 +79,12 @@ Plateau::Plateau (PlateauModel *pmod, int ct_shift)
   slope_est = 0.0f;
   dev_est = 0.0f;
   width_change = 0;
+  if (dss != NULL) delete dss;
   dss = NULL;
   locheight = 0.0f;
 }
 
 
-Plateau::~Plateau ()
-{
-  if (dss != NULL) delete dss;
-}
-
-
 bool Plateau::detect (const std::vector<Pt2f> &ptsh, bool all, float exh)
 {
   // Checks input point vector size
@@ -87,34 +95,33 @@ bool Plateau::detect (const std::vector<Pt2f> &ptsh, bool all, float exh)
   }
 
   // Detects height interval with the highest number of impacts
-  std::vector<Pt2f> ptsv (ptsh);
-  sort (ptsv.begin (), ptsv.end (), compHigher);
+  std::vector<float> hts;
+  sortHeights (ptsh, hts);
 
-  std::vector<Pt2f>::iterator it = ptsv.begin ();
+  std::vector<float>::iterator it = hts.begin ();
   int nbhmax = 1;
   int nbh = 1;
-  float meanh = it->y ();
+  float meanh = *it;
   float exhh = exh + 2 * pmod->thicknessTolerance ();
-  std::vector<Pt2f>::iterator itmin = it;
-  while (it != ptsv.end ())
+  std::vector<float>::iterator itmin = it;
+  while (it != hts.end ())
   {
-    if (all || it->y () < exh || it->y () >= exhh) nbh ++;
-    if (it->y () - itmin->y () > pmod->thicknessTolerance ())
+    if (all || *it < exh || *it >= exhh) nbh ++;
+    if (*it - *itmin > pmod->thicknessTolerance ())
     {
       do
       {
         itmin ++;
-        if (all || itmin->y () < exh || itmin->y () >= exhh) nbh --;
+        if (all || *itmin < exh || *itmin >= exhh) nbh --;
       }
-      while (itmin != it
-             && it->y () - itmin->y () > pmod->thicknessTolerance ());
+      while (itmin != it && *it - *itmin > pmod->thicknessTolerance ());
     }
     else
     {
       if (nbh > nbhmax)
       {
         nbhmax = nbh;
-        meanh = itmin->y ();
+        meanh = *itmin;
       }
     }
     it ++;
@@ -241,7 +248,47 @@ bool Plateau::detect (const std::vector<Pt2f> &ptsh, bool all, float exh)
 }
 
 
+void Plateau::toMillimeters (const std::vector<Pt2f> &ptsh,
+                             std::vector<Pt2i> &ptsi)
+{
+  ptsi.clear ();
+  if (ptsh.empty ()) return;
+  float loch = ptsh.front().y ();
+  for (std::vector<Pt2f>::const_iterator it = ptsh.begin ();
+       it != ptsh.end (); it ++)
+    ptsi.push_back (Pt2i (floor (it->x () * 1000),
+                          floor ((it->y () - loch) * 1000)));
+}
+
+
+int Plateau::firstStartIndex (const std::vector<Pt2i> &ptsi,
+                              float l12, float cshift) const
+{
+  float lcenter = l12 / 2 + cshift;
+  int icenter = (int) (lcenter * 1000
+                       + (lcenter < 0 && ! pmod->isNetBuildOn () ?
+                          - 0.5f : 0.5f));
+  return (nearestIndex (ptsi, icenter));
+}
+
+
+int Plateau::nearestIndex (const std::vector<Pt2i> &ptsi, int icenter)
+{
+  int myend = (int) (ptsi.size ());
+  for (int i = 0; i < myend; i++)
+    if (ptsi[i].x () > icenter)
+    {
+      if (i == 0) return 0;
+      else if (ptsi[i].x () - icenter > icenter - ptsi[i - 1].x ())
+        return (i - 1);
+      else return i;
+    }
+  return 0;
+}
+
+
 bool Plateau::track (const std::vector<Pt2f> &ptsh,
+                     const std::vector<Pt2i> &ptsi,
                      float lstart, float lend, float lheight,
                      float cshift, int confdist)
 {
@@ -276,30 +323,12 @@ bool Plateau::track (const std::vector<Pt2f> &ptsh,
   }
   int lpt = (int) (ptsh.size ()) - 1;
 
-  // Translates to int and finds start point
+  // Finds start point
   float lcenter = (lstart + lend) / 2 + cshift;
   int icenter = (int) (lcenter * 1000 + (lcenter < 0 ? - 0.5f : 0.5f));
-  int ifirst = 0;
-  int i = 0;
-  bool searching = true;
-  std::vector<Pt2i> ptsi;
-  std::vector<Pt2f>::const_iterator it = ptsh.begin ();
-  locheight = it->y ();
-  while (it != ptsh.end ())
-  {
-    int x = floor (it->x () * 1000);
-    if (searching && x > icenter)
-    {
-      searching = false;
-      if (i == 0) ifirst = 0;
-      else if (x - icenter > icenter - ptsi.back().x ()) ifirst = i - 1;
-      else ifirst = i;
-    }
-    ptsi.push_back (Pt2i (x, floor ((it->y () - locheight) * 1000)));
-    i ++;
-    it ++;
-  }
-  int myend = i;
+  int ifirst = nearestIndex (ptsi, icenter);
+  int myend = (int) (ptsi.size ());
+  locheight = ptsh.front().y ();
 
   // Checks the reference height
   if ((confdist != 0)
@@ -492,7 +521,8 @@ bool Plateau::track (const std::vector<Pt2f> &ptsh,
 
 
 // AMRELnet version
-bool Plateau::track (const std::vector<Pt2f> &ptsh, Plateau *refp,
+bool Plateau::track (const std::vector<Pt2f> &ptsh,
+                     const std::vector<Pt2i> &ptsi, Plateau *refp,
                      int confdist, float cshift, float l12)
 {
   if (confdist == 0)
@@ -670,30 +700,12 @@ bool Plateau::track (const std::vector<Pt2f> &ptsh, Plateau *refp,
     return false;
   }
 
-  // Translates to int and finds start point
+  // Finds start point
   float lcenter = (s_est + e_est) / 2 + cshift;
   int icenter = (int) (lcenter * 1000 + 0.5f);
-  int ifirst = 0;
-  int i = 0;
-  bool searching = true;
-  std::vector<Pt2i> ptsi;
-  std::vector<Pt2f>::const_iterator it = ptsh.begin ();
-  locheight = it->y ();
-  while (it != ptsh.end ())
-  {
-    int x = floor (it->x () * 1000);
-    if (searching && x > icenter)
-    {
-      searching = false;
-      if (i == 0) ifirst = 0;
-      else if (x - icenter > icenter - ptsi.back().x ()) ifirst = i - 1;
-      else ifirst = i;
-    }
-    ptsi.push_back (Pt2i (x, floor ((it->y () - locheight) * 1000)));
-    i ++;
-    it ++;
-  }
-  int myend = i;
+  int ifirst = nearestIndex (ptsi, icenter);
+  int myend = (int) (ptsi.size ());
+  locheight = ptsh.front().y ();
 
   // Checks the reference height
   if ((confdist != 0)
@@ -1164,9 +1176,54 @@ Pt2f Plateau::getDSSend () const
 }
 
 
-bool Plateau::compHigher (Pt2f p1, Pt2f p2)
+void Plateau::sortHeights (const std::vector<Pt2f> &ptsh,
+                           std::vector<float> &hts)
 {
-  return (p2.y () > p1.y ());
+  int nb = (int) (ptsh.size ());
+  hts.resize (nb);
+  if (nb == 0) return;
+  float hmin = ptsh.front().y (), hmax = hmin;
+  for (std::vector<Pt2f>::const_iterator it = ptsh.begin ();
+       it != ptsh.end (); it ++)
+  {
+    if (it->y () < hmin) hmin = it->y ();
+    else if (it->y () > hmax) hmax = it->y ();
+  }
+  if (hmax == hmin)
+  {
+    for (int i = 0; i < nb; i++) hts[i] = hmin;
+    return;
+  }
+
+  // Histogram of nb buckets, then placement by bucket
+  float bscale = (nb - 1) / (hmax - hmin);
+  std::vector<int> bstart (nb + 1, 0);
+  for (std::vector<Pt2f>::const_iterator it = ptsh.begin ();
+       it != ptsh.end (); it ++)
+  {
+    int k = (int) ((it->y () - hmin) * bscale);
+    bstart[(k < nb ? k : nb - 1) + 1] ++;
+  }
+  for (int k = 1; k < nb; k++) bstart[k] += bstart[k - 1];
+  for (std::vector<Pt2f>::const_iterator it = ptsh.begin ();
+       it != ptsh.end (); it ++)
+  {
+    int k = (int) ((it->y () - hmin) * bscale);
+    hts[bstart[k < nb ? k : nb - 1] ++] = it->y ();
+  }
+
+  // Buckets are in order : only their content is left to sort
+  for (int i = 1; i < nb; i++)
+  {
+    float h = hts[i];
+    int j = i;
+    while (j > 0 && h < hts[j - 1])
+    {
+      hts[j] = hts[j - 1];
+      j --;
+    }
+    hts[j] = h;
+  }
 }
 
 
@@ -1196,8 +1253,8 @@ bool Plateau::thinerThan (Plateau *pl) const
 {
   if (dss == NULL) return false;
   if (pl->dss == NULL) return true;
-  return (dss->width () * pl->dss->period ()
-          < pl->dss->width () * dss->period ());
+  return (((long long) dss->width ()) * pl->dss->period ()
+          < ((long long) pl->dss->width ()) * dss->period ());
 }
 
 
@@ -77,6 +77,14 @@ public:
    */
   ~Plateau ();
 
+  /**
+   * \brief Resets the plateau to its creation state for a new scan.
+   * Lets plateau pools recycle plateaux without reallocation.
+   * @param pmod Plateau detection features.
+   * @param ct_shift Center shift value (in pixels).
+   */
+  void reset (PlateauModel *pmod, int ct_shift);
+
   /**
    * \brief Returns the input scan center shift.
    */
@@ -91,16 +99,47 @@ public:
   bool detect (const std::vector<Pt2f> &ptsh,
                bool all = true, float exh = 0.0f);
 
+  /**
+   * \brief Converts scan points to integer millimeter coordinates.
+   * Heights are set relative to the first point height.
+   * @param ptsh Scan points sorted by increasing distance to scan start bound.
+   * @param ptsi Provided integer points, in the same order.
+   */
+  static void toMillimeters (const std::vector<Pt2f> &ptsh,
+                             std::vector<Pt2i> &ptsi);
+
+  /**
+   * \brief Provides the heights of scan points in increasing order.
+   * Heights are distributed in a histogram of as many buckets as points,
+   *   so that only the few heights sharing a bucket are left to sort.
+   * @param ptsh Scan points.
+   * @param hts Provided sorted heights.
+   */
+  static void sortHeights (const std::vector<Pt2f> &ptsh,
+                           std::vector<float> &hts);
+
+  /**
+   * \brief Returns the index of the point a first plateau track starts from.
+   * First plateau tracks (confdist = 0) only depend on this start point,
+   *   apart from the minimal height.
+   * @param ptsi Scan points in integer millimeters (see toMillimeters).
+   * @param l12 Scan length.
+   * @param cshift Reference center shift.
+   */
+  int firstStartIndex (const std::vector<Pt2i> &ptsi,
+                       float l12, float cshift) const;
+
   /**
    * \brief Detects the plateau in a scan knowing the neighboring plateau.
    * @param ptsh Scan points sorted by increasing distance to scan start bound.
+   * @param ptsi Scan points in integer millimeters (see toMillimeters).
    * @param lstart Awaited start position.
    * @param lend Awaited end position.
    * @param lheight Awaited altitude.
    * @param cshift Reference center shift.
    * @param confdist Distance to last reliable plateau (in count of stripes).
    */
-  bool track (const std::vector<Pt2f> &ptsh,
+  bool track (const std::vector<Pt2f> &ptsh, const std::vector<Pt2i> &ptsi,
               float lstart, float lend, float lheight,
               float cshift, int confdist);
 
@@ -109,11 +148,13 @@ public:
    * Ensures connexity between adjacent plateaux.
    * Specific version for road network extraction.
    * @param ptsh Scan points sorted by increasing distance to scan start bound.
+   * @param ptsi Scan points in integer millimeters (see toMillimeters).
    * @param refp Reference plateau (NULL if first detection)
    * @param confdist Distance to last reliable plateau (0 if first detection).
    * @param cshift Reference center shift.
    */
-  bool track (const std::vector<Pt2f> &ptsh, Plateau *refp,
+  bool track (const std::vector<Pt2f> &ptsh, const std::vector<Pt2i> &ptsi,
+              Plateau *refp,
               int confdist, float cshift, float l12 = 0.0f);
 
   /**
@@ -500,12 +541,14 @@ private :
    */
   void setPosition (float wmt);
 
+
   /**
-   * \brief Compares points by increasing altitude.
-   * @param p1 First point.
-   * @param p2 Second point.
+   * \brief Returns the index of the scan point nearest to a given distance.
+   * Returns 0 if all the points lie before this distance.
+   * @param ptsi Scan points in integer millimeters.
+   * @param icenter Distance in millimeters.
    */
-  static bool compHigher (Pt2f p1, Pt2f p2);
+  static int nearestIndex (const std::vector<Pt2i> &ptsi, int icenter);
 
   /**
    * \brief Compares points by increasing distance.
@@ -0,0 +1,39 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "plateaupool.h"
+
+
+PlateauPool::~PlateauPool ()
+{
+  std::vector<Plateau *>::iterator it = spare.begin ();
+  while (it != spare.end ()) delete *it++;
+}
+
+
+Plateau *PlateauPool::create (PlateauModel *pmod, int ct_shift)
+{
+  if (spare.empty ()) return (new Plateau (pmod, ct_shift));
+  Plateau *pl = spare.back ();
+  spare.pop_back ();
+  pl->reset (pmod, ct_shift);
+  return pl;
+}
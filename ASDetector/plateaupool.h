@@ -0,0 +1,70 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef PLATEAU_POOL_H
+#define PLATEAU_POOL_H
+
+#include <cstddef>
+#include <vector>
+#include "plateau.h"
+
+
+/** 
+ * @class PlateauPool plateaupool.h
+ * \brief Store of released plateaux for reuse by a track detector.
+ * Plateaux of failed trials and of discarded carriage tracks are given
+ *   back to the pool, then reset at next creation request.
+ */
+class PlateauPool
+{
+public:
+
+  /**
+   * \brief Creates an empty plateau pool.
+   */
+  PlateauPool () { }
+
+  /**
+   * \brief Deletes the plateau pool and the released plateaux.
+   */
+  ~PlateauPool ();
+
+  /**
+   * \brief Returns a new plateau, recycled if available.
+   * @param pmod Plateau detection features.
+   * @param ct_shift Center shift value (in pixels).
+   */
+  Plateau *create (PlateauModel *pmod, int ct_shift);
+
+  /**
+   * \brief Gives a plateau back to the pool.
+   * @param pl Plateau no more used.
+   */
+  inline void release (Plateau *pl) { if (pl != NULL) spare.push_back (pl); }
+
+
+private:
+
+  /** Released plateaux. */
+  std::vector<Plateau *> spare;
+};
+
+#endif
@@ -0,0 +1,121 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include "scansorter.h"
+
+
+void ScanSorter::sort (std::vector<Pt2f> &pts)
+{
+  int nb = (int) (pts.size ());
+  if (runs.back () != nb) runs.push_back (nb);
+  keys.resize (nb);
+  for (int i = 0; i < nb; i++) keys[i] = key (pts[i]);
+
+  // Finishes each run
+  int nbr = (int) (runs.size ()) - 1;
+  for (int k = 0; k < nbr; k++) sortRun (pts, runs[k], runs[k + 1]);
+
+  // Merges adjacent runs by pairs until one remains
+  if (nbr > 1)
+  {
+    tpts.resize (nb);
+    tkeys.resize (nb);
+  }
+  while (nbr > 1)
+  {
+    truns.clear ();
+    truns.push_back (0);
+    for (int k = 0; k < nbr; k += 2)
+    {
+      int i = runs[k];
+      if (k + 1 == nbr)
+      {
+        for (; i < nb; i++)
+        {
+          tpts[i].set (pts[i]);
+          tkeys[i] = keys[i];
+        }
+      }
+      else
+      {
+        int imax = runs[k + 1], j = imax, jmax = runs[k + 2], o = i;
+        while (i < imax && j < jmax)
+        {
+          if (keys[j] < keys[i])
+          {
+            tpts[o].set (pts[j]);
+            tkeys[o++] = keys[j++];
+          }
+          else
+          {
+            tpts[o].set (pts[i]);
+            tkeys[o++] = keys[i++];
+          }
+        }
+        for (; i < imax; i++, o++)
+        {
+          tpts[o].set (pts[i]);
+          tkeys[o] = keys[i];
+        }
+        for (; j < jmax; j++, o++)
+        {
+          tpts[o].set (pts[j]);
+          tkeys[o] = keys[j];
+        }
+      }
+      truns.push_back (runs[k + 2 < nbr ? k + 2 : nbr]);
+    }
+    pts.swap (tpts);
+    keys.swap (tkeys);
+    runs.swap (truns);
+    nbr = (int) (runs.size ()) - 1;
+  }
+  clear ();
+}
+
+
+void ScanSorter::sortRun (std::vector<Pt2f> &pts, int s, int e)
+{
+  if (keys[e - 1] < keys[s])
+  {
+    std::reverse (pts.begin () + s, pts.begin () + e);
+    std::reverse (keys.begin () + s, keys.begin () + e);
+  }
+  for (int i = s + 1; i < e; i++)
+  {
+    long long ki = keys[i];
+    if (ki < keys[i - 1])
+    {
+      Pt2f pi = pts[i];
+      int j = i;
+      do
+      {
+        pts[j].set (pts[j - 1]);
+        keys[j] = keys[j - 1];
+        j --;
+      }
+      while (j > s && ki < keys[j - 1]);
+      pts[j].set (pi);
+      keys[j] = ki;
+    }
+  }
+}
@@ -0,0 +1,100 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SCAN_SORTER_H
+#define SCAN_SORTER_H
+
+#include <cmath>
+#include <vector>
+#include "pt2f.h"
+
+
+/** 
+ * @class ScanSorter scansorter.h
+ * \brief Ordering of scanned points by distance to the scan bound.
+ * Points are collected cell after cell along each scan of a strip, so
+ *   that each scan provides a run that is nearly sorted (possibly in the
+ *   reverse order) : runs are finished by insertion sort, then merged.
+ * The final order is the one of CTrackDetector::compIFurther (distance,
+ *   then height, on millimeter basis).
+ * Buffers are kept between uses to avoid any allocation in steady state.
+ */
+class ScanSorter
+{
+public:
+
+  /**
+   * \brief Creates an empty scan sorter.
+   */
+  ScanSorter () { runs.push_back (0); }
+
+  /**
+   * \brief Forgets previous runs.
+   */
+  inline void clear () { runs.resize (1); }
+
+  /**
+   * \brief Closes a run of points.
+   * Empty runs are ignored.
+   * @param end Index following the last point of the run.
+   */
+  inline void closeRun (int end) { if (end != runs.back ()) runs.push_back (end); }
+
+  /**
+   * \brief Sorts the points of the closed runs.
+   * @param pts Points (distance, height) to sort.
+   */
+  void sort (std::vector<Pt2f> &pts);
+
+
+private:
+
+  /** Bounds of the runs : run k spans indices [runs[k], runs[k+1]). */
+  std::vector<int> runs;
+  /** Sorting keys of the points. */
+  std::vector<long long> keys;
+  /** Merge buffer for points. */
+  std::vector<Pt2f> tpts;
+  /** Merge buffer for keys. */
+  std::vector<long long> tkeys;
+  /** Merge buffer for run bounds. */
+  std::vector<int> truns;
+
+
+  /**
+   * \brief Returns the sorting key of a point.
+   * Keys are ordered by millimeter distance, then by millimeter height.
+   * @param p Point (distance, height).
+   */
+  static inline long long key (const Pt2f &p) {
+    return (((long long) floor (p.x () * 1000)) * 0x100000000LL
+            + ((long long) floor (p.y () * 1000))); }
+
+  /**
+   * \brief Insertion sort of a run, reversed first if descending.
+   * @param pts Points to sort.
+   * @param s Run start index.
+   * @param e Index following the run end.
+   */
+  void sortRun (std::vector<Pt2f> &pts, int s, int e);
+};
+
+#endif
@@ -99,9 +99,13 @@ AmrelConfig::AmrelConfig ()
   fly_size = DEFAULT_FLY_SIZE;
   pad_size = 0;
   buf_size = 0;
+  asd_regions = 0;
   tail_min_size = -1;  // undetermined
   extraction_step = STEP_ALL;
   connected_mode = true;
+  nfa_filter = false;
+  seed_dedup = false;
+  stream_mode = false;
   hill_map = false;
   out_map = false;
   back_dtm = false;
@@ -141,10 +145,18 @@ AmrelConfig::AmrelConfig ()
           setPadSize (getValue (input, "PAD_SIZE"));
         else if (std::string (cfg_param) == std::string ("BUFFER_SIZE"))
           setBufferSize (getValue (input, "BUFFER_SIZE"));
+        else if (std::string (cfg_param) == std::string ("ASD_REGIONS"))
+          setAsdRegions (getValue (input, "ASD_REGIONS"));
         else if (std::string (cfg_param) == std::string ("TAIL_MIN_SIZE"))
           tail_min_size = getValue (input, "TAIL_MIN_SIZE");
         else if (std::string (cfg_param) == std::string ("CONNECTED"))
           connected_mode = getStatus (input, "CONNECTED");
+        else if (std::string (cfg_param) == std::string ("NFA"))
+          nfa_filter = getStatus (input, "NFA");
+        else if (std::string (cfg_param) == std::string ("SEED_DEDUP"))
+          seed_dedup = getStatus (input, "SEED_DEDUP");
+        else if (std::string (cfg_param) == std::string ("STREAM"))
+          stream_mode = getStatus (input, "STREAM");
         else if (std::string (cfg_param) == std::string ("STEP"))
         {
           std::string clac = getName (input, "STEP");
@@ -554,6 +566,19 @@ bool AmrelConfig::setBufferSize (int size)
 }
 
 
+bool AmrelConfig::setAsdRegions (int nb)
+{
+  if (nb < 0)
+  {
+    std::cout << "Beware : only positive values for region count !"
+              << std::endl;
+    return false;
+  }
+  asd_regions = nb;
+  return true;
+}
+
+
 bool AmrelConfig::setTailMinSize (int size)
 {
   if (size < 0)
@@ -615,12 +640,16 @@ void AmrelConfig::saveDetectorStatus () const
   output << "SeedWidth=" << seed_width << std::endl;
   output << "PadSize=" << pad_size << std::endl;
   output << "BufferSize=" << buf_size << std::endl;
+  output << "AsdRegions=" << asd_regions << std::endl;
   output << "Connected=" << (connected_mode ? "true" : "false") << std::endl;
+  output << "NFAFilter=" << (nfa_filter ? "true" : "false") << std::endl;
+  output << "Streaming=" << (stream_mode ? "true" : "false") << std::endl;
   output << std::endl;
 
   output << "[ASD]" << std::endl;
   output << "CloudAccess=" << cloud_access << std::endl;
   output << "DetectionMode=1" << std::endl;
+  output << "SeedDedup=" << (seed_dedup ? "true" : "false") << std::endl;
   output << std::endl;
 
   output << "[CTrack]" << std::endl;
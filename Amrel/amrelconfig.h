@@ -286,6 +286,20 @@ public:
    */
   bool setBufferSize (int size);
 
+  /**
+   * \brief Returns the count of parallel regions for buffered road extraction.
+   */
+  inline int asdRegions () const { return asd_regions; }
+
+  /**
+   * \brief Sets the count of parallel regions for buffered road extraction.
+   * Detection order differs at region borders, so that roads crossing a
+   *   border may be traced from other seeds than in a single sweep.
+   * Returns if new count is accepted.
+   * @param nb New count (0 for a single sweep).
+   */
+  bool setAsdRegions (int nb);
+
   /**
    * \brief Returns tail pruning minimal size.
    */
@@ -325,6 +339,39 @@ public:
    */
   inline void setConnected (bool status) { connected_mode = status; }
 
+  /**
+   * \brief Returns NFA-based filtering status of straight segments.
+   */
+  inline bool isNfaOn () const { return nfa_filter; }
+
+  /**
+   * \brief Sets NFA-based filtering status of straight segments.
+   * @param status New status value.
+   */
+  inline void setNfa (bool status) { nfa_filter = status; }
+
+  /**
+   * \brief Returns duplicate seeds removal status.
+   */
+  inline bool isSeedDedupOn () const { return seed_dedup; }
+
+  /**
+   * \brief Sets duplicate seeds removal status.
+   * @param status New status value.
+   */
+  inline void setSeedDedup (bool status) { seed_dedup = status; }
+
+  /**
+   * \brief Returns streaming status of seed production and road extraction.
+   */
+  inline bool isStreamOn () const { return stream_mode; }
+
+  /**
+   * \brief Sets streaming status of seed production and road extraction.
+   * @param status New status value.
+   */
+  inline void setStream (bool status) { stream_mode = status; }
+
   /**
    * \brief Returns hill-shaded map display status.
    */
@@ -530,6 +577,8 @@ private:
   int pad_size;
   /** Tile set size for road extraction. */
   int buf_size;
+  /** Count of parallel regions for buffered road extraction. */
+  int asd_regions;
   /** Tail pruning minimal size. */
   int tail_min_size;
 
@@ -537,6 +586,12 @@ private:
   int extraction_step;
   /** Road connection status. */
   bool connected_mode;
+  /** NFA-based filtering status of straight segments. */
+  bool nfa_filter;
+  /** Duplicate seeds removal status. */
+  bool seed_dedup;
+  /** Streaming status of seed production and road extraction. */
+  bool stream_mode;
   /** Rorpo-skipped mode. */
   bool no_rorpo;
   /** Hill-shaded map production status. */
@@ -19,13 +19,15 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include "amrelmap.h"
 
 
-AmrelMap::AmrelMap (int w, int h, AmrelConfig *config)
+AmrelMap::AmrelMap (int w, int h, AmrelConfig *config, int x0)
 {
   mw = w;
   mh = h;
+  mx = x0;
   cfg = config;
   nbroads = (unsigned short) 0;
   track_map = new unsigned short[mw * mh];
@@ -39,14 +41,44 @@ AmrelMap::~AmrelMap ()
 }
 
 
-bool AmrelMap::add (std::vector<std::vector<Pt2i> > &pts, bool verbose)
+bool AmrelMap::add (const CTrackSpans &spans, bool verbose)
 {
   (void) verbose;
   ++ nbroads;
-  for (std::vector<std::vector<Pt2i> >::iterator lit = pts.begin ();
-       lit != pts.end (); lit ++)
-    for (std::vector<Pt2i>::iterator pit = lit->begin ();
-         pit != lit->end (); pit++)
-      track_map[(mh - 1 - pit->y ()) * mw + pit->x ()] = nbroads;
+  for (int i = 0; i < spans.size (); i++)
+  {
+    int x = spans.start(i).x ();
+    int y = spans.start(i).y ();
+    int l = spans.length (i);
+    if (spans.alongRows ())
+    {
+      // Clips the run, then fills it in the flipped row
+      if (y < 0 || y >= mh) continue;
+      if (x < mx)
+      {
+        l -= mx - x;
+        x = mx;
+      }
+      if (x + l > mx + mw) l = mx + mw - x;
+      if (l > 0)
+      {
+        unsigned short *pix = track_map + (mh - 1 - y) * mw + x - mx;
+        std::fill (pix, pix + l, nbroads);
+      }
+    }
+    else
+    {
+      // Clips the run, then fills it in the column, upwards in the map
+      if (x < mx || x >= mx + mw) continue;
+      if (y < 0)
+      {
+        l += y;
+        y = 0;
+      }
+      if (y + l > mh) l = mh - y;
+      unsigned short *pix = track_map + (mh - 1 - y) * mw + x - mx;
+      for (int k = 0; k < l; k++, pix -= mw) *pix = nbroads;
+    }
+  }
   return true;
 }
@@ -24,6 +24,7 @@
 
 #include "terrainmap.h"
 #include "amrelconfig.h"
+#include "ctrackspans.h"
 
 
 /** 
@@ -39,8 +40,9 @@ public:
    * @param w Map width.
    * @param h Map height.
    * @param config Pointer to current tool configuration.
+   * @param x0 Map left column in whole map (for a partial map).
    */
-  AmrelMap (int w, int h, AmrelConfig *config);
+  AmrelMap (int w, int h, AmrelConfig *config, int x0 = 0);
 
   /**
    * \brief Deletes the map.
@@ -72,15 +74,24 @@ public:
    * @param pix Pixel in the map.
    */
   inline bool occupied (const Pt2i &pix) const {
-    return (track_map[(mh - 1 - pix.y ()) * mw + pix.x ()]
+    return (track_map[(mh - 1 - pix.y ()) * mw + pix.x () - mx]
             != (unsigned short) 0); }
 
+  /**
+   * \brief Returns the number of the road occupying a map pixel (0 if free).
+   * Roads are numbered from 1 in the order they were added.
+   * @param pix Pixel in the map.
+   */
+  inline int roadAt (const Pt2i &pix) const {
+    return ((int) (track_map[(mh - 1 - pix.y ()) * mw + pix.x () - mx])); }
+
   /**
    * \brief Adds a detected road to the map.
+   * Points out of the map are ignored.
    * Returns whether adding succeeded.
-   * @param pts Set of plateau points of the detected road.
+   * @param spans Pixel runs of the detected road.
    */
-  bool add (std::vector<std::vector<Pt2i> > &pts, bool verb = false);
+  bool add (const CTrackSpans &spans, bool verb = false);
 
   /**
    * \brief Sets displayed seeds.
@@ -98,6 +109,8 @@ private:
   int mw;
   /** Map height. */
   int mh;
+  /** Map left column in whole map. */
+  int mx;
   /** Number of displayed roads. */
   unsigned short nbroads;
   /** Tool configuration. */
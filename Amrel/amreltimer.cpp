@@ -22,7 +22,14 @@
 #include <iostream>
 #include <fstream>
 #include <chrono>
+#include <cstdlib>
+#include <algorithm>
 #include "amreltimer.h"
+#include "scannerprovider.h"
+#include "steppatterns.h"
+#include "scansorter.h"
+#include "ctrackdetector.h"
+#include "plateau.h"
 
 
 const int AmrelTimer::NO_TEST = 0;
@@ -30,6 +37,8 @@ const int AmrelTimer::FULL = 1;
 const int AmrelTimer::FULL_WITHOUT_LOAD = 2;
 const int AmrelTimer::ONLY_LOAD = 3;
 const int AmrelTimer::BY_STEP = 4;
+const int AmrelTimer::SCANNERS = 5;
+const int AmrelTimer::SCAN_SORT = 6;
 
 
 AmrelTimer::AmrelTimer (AmrelTool *amreltool)
@@ -46,6 +55,16 @@ AmrelTimer::~AmrelTimer ()
 
 void AmrelTimer::run ()
 {
+  if (test_type == SCANNERS)
+  {
+    scannerTest ();
+    return;
+  }
+  if (test_type == SCAN_SORT)
+  {
+    scanSortTest ();
+    return;
+  }
   if (! amrel->config()->setTiles ()) return;
   bool verb = amrel->config()->isVerboseOn ();
   amrel->config()->setVerbose (false);
@@ -378,6 +397,10 @@ void AmrelTimer::fbsdTest ()
             end - start);
   std::cout << "FBSD: timing for " << test_count << " run = "
             << time_span.count () << " s" << std::endl;
+  std::cout << "FBSD: " << amrel->segmentDetector ()->countOfStrokes ()
+            << " strokes for "
+            << amrel->segmentDetector ()->countOfScratchAllocations ()
+            << " scratch buffer allocations" << std::endl;
   if (! amrel->saveFbsdSegments ())
     std::cout << "Fbsd : segments saving failed" << std::endl;
   else
@@ -459,3 +482,156 @@ void AmrelTimer::asdTest ()
   amrel->saveAsdImage (AmrelConfig::RES_DIR
                        + AmrelConfig::ROAD_FILE + AmrelConfig::IM_SUFFIX);
 }
+
+
+void AmrelTimer::scannerTest ()
+{
+  const int area = 1000;
+  const int strokes = 20000 * test_count;
+  const int scans = 40;
+  ScannerProvider sp;
+  sp.setSize (area, area);
+  std::vector<Pt2i> pix;
+  std::cout << "Time perf for directional scanners..." << std::endl;
+  for (int local = 0; local < 2; local ++)
+  {
+    srand (1);
+    long nbpts = 0;
+    std::chrono::high_resolution_clock::time_point start
+          = std::chrono::high_resolution_clock::now ();
+    for (int i = 0; i < strokes; i++)
+    {
+      Pt2i p1 (rand () % area, rand () % area);
+      Pt2i p2 (p1.x () + rand () % 41 - 20, p1.y () + rand () % 41 - 20);
+      if (p2.equals (p1)) p2.set (p1.x () + 1, p1.y ());
+      bool adaptive = (i % 2 == 0);
+      if (local)
+      {
+        StripScanner ds;
+        sp.setScanner (ds, p1, p2, adaptive);
+        nbpts += ds.first (pix);
+        for (int j = 0; j < scans; j++)
+          nbpts += ds.nextOnLeft (pix) + ds.nextOnRight (pix);
+      }
+      else
+      {
+        DirectionalScanner *ds = sp.getScanner (p1, p2, adaptive);
+        nbpts += ds->first (pix);
+        for (int j = 0; j < scans; j++)
+          nbpts += ds->nextOnLeft (pix) + ds->nextOnRight (pix);
+        delete ds;
+      }
+      pix.clear ();
+    }
+    std::chrono::high_resolution_clock::time_point end
+          = std::chrono::high_resolution_clock::now ();
+    std::chrono::duration<double> time_span
+          = std::chrono::duration_cast<std::chrono::duration<double>> (
+              end - start);
+    std::cout << (local ? "Local" : "Virtual") << " scanners: timing for "
+              << strokes << " strips = " << time_span.count () << " s ("
+              << nbpts << " points)" << std::endl;
+  }
+
+  // Scanner setting only, with long strokes
+  srand (1);
+  StripScanner ds;
+  std::chrono::high_resolution_clock::time_point start
+          = std::chrono::high_resolution_clock::now ();
+  for (int i = 0; i < strokes * scans; i++)
+  {
+    Pt2i p1 (rand () % area, rand () % area);
+    Pt2i p2 (p1.x () + rand () % 201 - 100, p1.y () + rand () % 201 - 100);
+    if (p2.equals (p1)) p2.set (p1.x () + 1, p1.y ());
+    sp.setScanner (ds, p1, p2, true);
+  }
+  std::chrono::high_resolution_clock::time_point end
+          = std::chrono::high_resolution_clock::now ();
+  std::chrono::duration<double> time_span
+          = std::chrono::duration_cast<std::chrono::duration<double>> (
+              end - start);
+  std::cout << "Scanner setting: timing for " << (strokes * scans)
+            << " strips = " << time_span.count () << " s ("
+            << StepPatterns::countOfPatterns () << " shared step patterns)"
+            << std::endl;
+}
+
+
+void AmrelTimer::scanSortTest ()
+{
+  const int scans = 20000 * test_count;
+  const int subdiv = 5;
+  const int cells = 80;
+  const float csize = 0.5f;
+  std::vector<Pt2f> pts, ref, sorted;
+  std::vector<float> hts;
+  ScanSorter sorter;
+  std::cout << "Time perf for scan point sorting..." << std::endl;
+  double tsort = 0., tmerge = 0., thsort = 0., thist = 0.;
+  long nbpts = 0;
+  bool same = true;
+  srand (1);
+  for (int i = 0; i < scans; i++)
+  {
+    // Builds a strip of runs collected cell after cell, as in ASD
+    pts.clear ();
+    sorter.clear ();
+    for (int k = 0; k < subdiv; k++)
+    {
+      bool down = ((rand () % 2) == 0);
+      for (int c = 0; c < cells; c++)
+      {
+        int cell = (down ? cells - 1 - c : c);
+        int nb = rand () % 6;
+        for (int j = 0; j < nb; j++)
+          pts.push_back (Pt2f (csize * (cell + (rand () % 1200) / 1000.0f),
+                               500.0f + (rand () % 3000) / 1000.0f));
+      }
+      sorter.closeRun ((int) (pts.size ()));
+    }
+    nbpts += (long) (pts.size ());
+    ref = pts;
+    sorted = pts;
+
+    std::chrono::high_resolution_clock::time_point start
+          = std::chrono::high_resolution_clock::now ();
+    std::sort (ref.begin (), ref.end (), CTrackDetector::compIFurther);
+    std::chrono::high_resolution_clock::time_point mid
+          = std::chrono::high_resolution_clock::now ();
+    sorter.sort (sorted);
+    std::chrono::high_resolution_clock::time_point end
+          = std::chrono::high_resolution_clock::now ();
+    tsort += std::chrono::duration_cast<std::chrono::duration<double>> (
+               mid - start).count ();
+    tmerge += std::chrono::duration_cast<std::chrono::duration<double>> (
+                end - mid).count ();
+    for (int j = 0; same && j < (int) (ref.size ()); j++)
+      if (CTrackDetector::compIFurther (ref[j], sorted[j])
+          || CTrackDetector::compIFurther (sorted[j], ref[j])) same = false;
+
+    // Height ordering as in plateau detection
+    start = std::chrono::high_resolution_clock::now ();
+    std::vector<float> refh;
+    for (std::vector<Pt2f>::iterator it = pts.begin ();
+         it != pts.end (); it ++) refh.push_back (it->y ());
+    std::sort (refh.begin (), refh.end ());
+    mid = std::chrono::high_resolution_clock::now ();
+    Plateau::sortHeights (pts, hts);
+    end = std::chrono::high_resolution_clock::now ();
+    thsort += std::chrono::duration_cast<std::chrono::duration<double>> (
+                mid - start).count ();
+    thist += std::chrono::duration_cast<std::chrono::duration<double>> (
+               end - mid).count ();
+    if (hts != refh) same = false;
+  }
+  std::cout << scans << " scans (" << nbpts << " points)" << std::endl;
+  std::cout << "Distance sort: " << tsort << " s ("
+            << tsort * 1000000 / scans << " us/scan)" << std::endl;
+  std::cout << "Run merge: " << tmerge << " s ("
+            << tmerge * 1000000 / scans << " us/scan)" << std::endl;
+  std::cout << "Height sort: " << thsort << " s ("
+            << thsort * 1000000 / scans << " us/scan)" << std::endl;
+  std::cout << "Height histogram: " << thist << " s ("
+            << thist * 1000000 / scans << " us/scan)" << std::endl;
+  if (! same) std::cout << "Scan sort: inconsistent orders" << std::endl;
+}
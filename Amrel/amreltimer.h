@@ -43,6 +43,10 @@ public:
   static const int ONLY_LOAD;
   /** Tested AMREL step : all AMREL steps. */
   static const int BY_STEP;
+  /** Tested AMREL step : directional scanners (no tile needed). */
+  static const int SCANNERS;
+  /** Tested AMREL step : ordering of scan points (no tile needed). */
+  static const int SCAN_SORT;
 
 
   /**
@@ -130,6 +134,16 @@ public:
    */
   void seedsTest ();
 
+  /**
+   * Compares heap allocated virtual scanners to local strip scanners.
+   */
+  void scannerTest ();
+
+  /**
+   * Compares full sorts of scan points to run merges and height histograms.
+   */
+  void scanSortTest ();
+
 
 private:
 
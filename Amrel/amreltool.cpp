@@ -20,10 +20,13 @@
 */
 
 #include <iostream>
+#include <algorithm>
 #include <fstream>
 #include <cmath>
 #include <ctime>
+#include <omp.h>
 #include "amreltool.h"
+#include "dssfile.h"
 #include "shapefil.h"
 
 #include "rorpo.hpp"
@@ -65,6 +68,9 @@ AmrelTool::AmrelTool ()
   if (bsdet.isNFA ()) bsdet.switchNFA ();
   save_seeds = true;
   detection_map = NULL;
+  asd_thread = NULL;
+  asd_ok = false;
+  seed_rows = -1;
 }
 
 
@@ -141,6 +147,7 @@ void AmrelTool::clearSeeds ()
     delete [] out_seeds;
   }
   out_seeds = NULL;
+  seeds_in.close ();
 }
 
 
@@ -158,20 +165,27 @@ void AmrelTool::clearAsd ()
 
 void AmrelTool::addTrackDetector ()
 {
-  ctdet = new CTrackDetector ();
-  ctdet->setPlateauLackTolerance (NOMINAL_PLATEAU_LACK_TOLERANCE);
-  ctdet->setMaxShiftLength (NOMINAL_MAX_SHIFT_LENGTH);
-  if (ctdet->isInitializationOn ()) ctdet->switchInitialization ();
-  ctdet->model()->setMinLength (NOMINAL_PLATEAU_MIN_LENGTH);
-  ctdet->model()->setThicknessTolerance (NOMINAL_PLATEAU_THICKNESS_TOLERANCE);
-  ctdet->model()->setSlopeTolerance (NOMINAL_SLOPE_TOLERANCE);
-  ctdet->model()->setSideShiftTolerance (NOMINAL_SIDE_SHIFT_TOLERANCE);
-  ctdet->model()->setBSmaxTilt (NOMINAL_PLATEAU_MAX_TILT);
-  if (ptset != NULL)
-    ctdet->setPointsGrid (ptset, vm_width, vm_height, sub_div, csize);
+  ctdet = newTrackDetector ();
   cfg.setDetector (ctdet);
-  ctdet->setAutomatic (true);
-  adaptTrackDetector ();
+}
+
+
+CTrackDetector *AmrelTool::newTrackDetector ()
+{
+  CTrackDetector *det = new CTrackDetector ();
+  det->setPlateauLackTolerance (NOMINAL_PLATEAU_LACK_TOLERANCE);
+  det->setMaxShiftLength (NOMINAL_MAX_SHIFT_LENGTH);
+  if (det->isInitializationOn ()) det->switchInitialization ();
+  det->model()->setMinLength (NOMINAL_PLATEAU_MIN_LENGTH);
+  det->model()->setThicknessTolerance (NOMINAL_PLATEAU_THICKNESS_TOLERANCE);
+  det->model()->setSlopeTolerance (NOMINAL_SLOPE_TOLERANCE);
+  det->model()->setSideShiftTolerance (NOMINAL_SIDE_SHIFT_TOLERANCE);
+  det->model()->setBSmaxTilt (NOMINAL_PLATEAU_MAX_TILT);
+  if (ptset != NULL)
+    det->setPointsGrid (ptset, vm_width, vm_height, sub_div, csize);
+  det->setAutomatic (true);
+  adaptTrackDetector (det);
+  return det;
 }
 
 
@@ -303,18 +317,19 @@ void AmrelTool::run ()
   //-------------------------------------------------------------------------
   else if (cfg.step () == AmrelConfig::STEP_ALL)
   {
-    if (processSawing ())
-      if (processAsd ())
+    bool sawn = processSawing (cfg.isStreamOn ());
+    if (cfg.isStreamOn () ? endStreamedAsd () && sawn
+                          : sawn && processAsd ())
+    {
+      detection_map->setDisplayedSeeds (&connection_seeds);
+      saveAsdImage (AmrelConfig::RES_DIR
+                    + AmrelConfig::ROAD_FILE + AmrelConfig::IM_SUFFIX);
+      if (cfg.isExportOn ())
       {
-        detection_map->setDisplayedSeeds (&connection_seeds);
-        saveAsdImage (AmrelConfig::RES_DIR
-                      + AmrelConfig::ROAD_FILE + AmrelConfig::IM_SUFFIX);
-        if (cfg.isExportOn ())
-        {
-          if (cfg.isExportBoundsOn ()) exportRoads ();
-          else exportRoadCenters ();
-        }
+        if (cfg.isExportBoundsOn ()) exportRoads ();
+        else exportRoadCenters ();
       }
+    }
   }
 
 
@@ -454,6 +469,7 @@ void AmrelTool::processFbsd ()
   if (cfg.isVerboseOn ()) std::cout << "FBSD ..." << std::endl;
   bsdet.setAssignedThickness (cfg.maxBSThickness ());
   bsdet.resetMaxDetections ();
+  if (bsdet.isNFA () != cfg.isNfaOn ()) bsdet.switchNFA ();
   bsdet.detectAll ();
   bsdet.copyDigitalStraightSegments (dss);
   if (cfg.isVerboseOn ()) std::cout << "FBSD OK : " << dss.size ()
@@ -467,9 +483,7 @@ void AmrelTool::processSeeds (int kref)
   int nbs = 0;
   int nbsmall = 0;
   int nbout = 0;
-  int max = 0;
-  AbsRat x1r, y1r, x2r, y2r;
-  float x1, y1, x2, y2, ln, dx, dy;
+  int nbshared = 0;
 
   int tsw = ptset->columnsOfTiles();
   int tsh = ptset->rowsOfTiles();
@@ -490,63 +504,126 @@ void AmrelTool::processSeeds (int kref)
     if (dtm_in != NULL) pim_h = dtm_in->padHeight () * th;
   }
   int skx = kx * tw;
-  int sky = ky * th + pim_h - 1;
+  int sky = ky * th;
   int mbsl2 = cfg.minBSLength () * cfg.minBSLength ();
-
-  std::vector<DigitalStraightSegment>::iterator it = dss.begin ();
   int sshift = cfg.seedShift ();
   int sw2 = cfg.seedWidth () / 2;
-  while (it != dss.end ())
+
+  // Seeds are computed in pad coordinates (from the pad lower left corner)
+  //   and only accepted ones are set in map coordinates.
+  // Acceptance rectangle of seed ends : tile set bounds.
+  int pxmin = - skx, pymin = - sky;
+  int pxmax = (tsw - kx) * tw, pymax = (tsh - ky) * th;
+  bool padded = (kref != -1 && dtm_in != NULL);
+  if (padded)
   {
-    int dsl = it->length2 ();
-    if (dsl > max) max = dsl;
-    if (dsl < mbsl2) nbsmall ++;
-    else
+    // Pad image bounds, with the margin of seed strokes and rounding
+    int pad_w = dtm_in->padWidth ();
+    int pad_h = dtm_in->padHeight ();
+    if (pxmin < - sw2 - 1) pxmin = - sw2 - 1;
+    if (pymin < - sw2 - 1) pymin = - sw2 - 1;
+    if (pxmax > pad_w * tw + sw2 + 1) pxmax = pad_w * tw + sw2 + 1;
+    if (pymax > pad_h * th + sw2 + 1) pymax = pad_h * th + sw2 + 1;
+  }
+
+  // Window of the tiles reached by the centres of accepted seeds
+  int wxmin = (skx + pxmin) / tw, wxmax = (skx + pxmax - 1) / tw + 1;
+  int wymin = (sky + pymin) / th, wymax = (sky + pymax - 1) / th + 1;
+  if (wxmin < 0) wxmin = 0;
+  if (wxmax > tsw) wxmax = tsw;
+  if (wymin < 0) wymin = 0;
+  if (wymax > tsh) wymax = tsh;
+  int ww = (wxmax > wxmin ? wxmax - wxmin : 0);
+  int nbtiles = ww * (wymax > wymin ? wymax - wymin : 0);
+
+  // Segments are split in contiguous chunks, each filling its own buckets
+  //   of window tiles, which are then appended in chunk order to keep seed
+  //   order. Buckets are kept from one pad to the next.
+  int nbsegs = (int) (dss.size ());
+  const DigitalStraightSegment *segs = dss.data ();
+  int nbchunks = omp_get_max_threads ();
+  if (nbchunks > nbsegs) nbchunks = (nbsegs == 0 ? 1 : nbsegs);
+  if ((int) (seed_buckets.size ()) < nbchunks * nbtiles)
+    seed_buckets.resize (nbchunks * nbtiles);
+  std::vector<Pt2i> *chunk_seeds = seed_buckets.data ();
+  #pragma omp parallel for schedule (static, 1) \
+                           reduction (+:nbs,nbsmall,nbout)
+  for (int ch = 0; ch < nbchunks; ch++)
+  {
+    std::vector<Pt2i> *seeds = chunk_seeds + ch * nbtiles;
+    AbsRat x1r, y1r, x2r, y2r;
+    float x1, y1, x2, y2, ln, dx, dy;
+    int send = (int) (((long) nbsegs * (ch + 1)) / nbchunks);
+    for (int i = (int) (((long) nbsegs * ch) / nbchunks); i < send; i++)
     {
-      it->naiveLine (x1r, y1r, x2r, y2r);
-      x1 = x1r.num () / (float) x1r.den ();
-      y1 = y1r.num () / (float) y1r.den ();
-      x2 = x2r.num () / (float) x2r.den ();
-      y2 = y2r.num () / (float) y2r.den ();
-      ln = (float) sqrt ((x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1));
-      dx = (x2 - x1) / ln;
-      dy = (y2 - y1) / ln;
-      for (float pos = 0.0f; pos <= ln; pos += sshift)
+      const DigitalStraightSegment *it = segs + i;
+      if (it->length2 () < mbsl2) nbsmall ++;
+      else
       {
-        Pt2i pt1 (skx + (int) (x1 + pos * dx - sw2 * dy + 0.5f),
-                  sky - (int) (y1 + pos * dy + sw2 * dx + 0.5f));
-        Pt2i pt2 (skx + (int) (x1 + pos * dx + sw2 * dy + 0.5f),
-                  sky - (int) (y1 + pos * dy - sw2 * dx + 0.5f));
-        if (pt1.x () < 0 || pt1.x () >= tsw * tw
-            || pt1.y () < 0 || pt1.y () >= tsh * th
-            || pt2.x () < 0 || pt2.x () >= tsw * tw
-            || pt2.y () < 0 || pt2.y () >= tsh * th) nbout ++;
-        else
+        it->naiveLine (x1r, y1r, x2r, y2r);
+        x1 = x1r.num () / (float) x1r.den ();
+        y1 = y1r.num () / (float) y1r.den ();
+        x2 = x2r.num () / (float) x2r.den ();
+        y2 = y2r.num () / (float) y2r.den ();
+        ln = (float) sqrt ((x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1));
+        dx = (x2 - x1) / ln;
+        dy = (y2 - y1) / ln;
+        for (float pos = 0.0f; pos <= ln; pos += sshift)
         {
-          int tilex = ((pt1.x () + pt2.x ()) / 2) / tw;
-          if (tilex < 0) tilex = 0;
-          else if (tilex >= tsw) tilex = tsw - 1;
-          int tiley = ((pt1.y () + pt2.y ()) / 2) / th;
-          if (tiley < 0) tiley = 0;
-          else if (tiley >= tsh) tiley = tsh - 1;
-          // Ckecks the tile exists ...
-          if (ptset->isLoaded (tiley * tsw + tilex))
+          // image rows are stored top down
+          int xl1 = (int) (x1 + pos * dx - sw2 * dy + 0.5f);
+          int yl1 = pim_h - 1 - (int) (y1 + pos * dy + sw2 * dx + 0.5f);
+          int xl2 = (int) (x1 + pos * dx + sw2 * dy + 0.5f);
+          int yl2 = pim_h - 1 - (int) (y1 + pos * dy - sw2 * dx + 0.5f);
+          if (xl1 < pxmin || xl1 >= pxmax || yl1 < pymin || yl1 >= pymax
+              || xl2 < pxmin || xl2 >= pxmax || yl2 < pymin || yl2 >= pymax)
+            nbout ++;
+          else
           {
-            out_seeds[tiley * tsw + tilex].push_back (pt1);
-            out_seeds[tiley * tsw + tilex].push_back (pt2);
-            nbs ++;
+            int tilex = (2 * skx + xl1 + xl2) / (2 * tw);
+            int tiley = (2 * sky + yl1 + yl2) / (2 * th);
+            // Ckecks the tile exists ...
+            if (ptset->isLoaded (tiley * tsw + tilex))
+            {
+              std::vector<Pt2i> &tseeds
+                = seeds[(tiley - wymin) * ww + tilex - wxmin];
+              tseeds.push_back (Pt2i (skx + xl1, sky + yl1));
+              tseeds.push_back (Pt2i (skx + xl2, sky + yl2));
+              nbs ++;
+            }
+            else nbout ++;
           }
-          else nbout ++;
         }
       }
     }
-    it ++;
+  }
+  #pragma omp parallel for schedule (dynamic, 16) reduction (+:nbshared)
+  for (int t = 0; t < nbtiles; t++)
+  {
+    int k = (wymin + t / ww) * tsw + wxmin + t % ww;
+    std::vector<Pt2i> &tseeds = out_seeds[k];
+    int nbprev = (int) (tseeds.size ()) / 2;
+    for (int ch = 0; ch < nbchunks; ch++)
+    {
+      std::vector<Pt2i> &seeds = chunk_seeds[ch * nbtiles + t];
+      if (! seeds.empty ())
+      {
+        tseeds.insert (tseeds.end (), seeds.begin (), seeds.end ());
+        seeds.clear ();
+      }
+    }
+    if (padded && nbprev != 0 && (int) (tseeds.size ()) != 2 * nbprev)
+      nbshared += dropPadDuplicates (k, nbprev);
   }
   if (cfg.isVerboseOn ())
-    std::cout << "Seeds OK : " << nbs << " seeds, " << nbsmall
+  {
+    std::cout << "Seeds OK : " << nbs - nbshared << " seeds, " << nbsmall
     //          << " rejected segments, " << nbout << " seeds out BS"
-              << " rejected segments"
-              << std::endl;
+              << " rejected segments";
+    if (nbshared != 0)
+      std::cout << ", " << nbshared << " seeds already found by previous pads";
+    std::cout << std::endl;
+  }
 }
 
 
@@ -571,52 +648,40 @@ bool AmrelTool::processAsd ()
   if (detection_map != NULL) delete detection_map;
   detection_map = new AmrelMap (vm_width, vm_height, &cfg);
   if (ctdet == NULL) addTrackDetector ();
-  std::vector<Pt2i>::iterator it;
+  for (int w = 1; w < omp_get_max_threads (); w++)
+    asd_workers.push_back (newTrackDetector ());
+  int nbdet = 0;
+  int nbdup = 0;
+
+  if (cfg.bufferSize () != 0 && cfg.asdRegions () > 1 && cot > 1)
+  {
+    nbdet += processRegions (cfg.asdRegions (), num, unused, nbdup);
+  }
 
-  if (cfg.bufferSize () != 0)
+  else if (cfg.bufferSize () != 0)
   {
     if (! buf_created) ptset->createBuffers ();
     buf_created = true; // avoids re-creation
     int k = ptset->nextTile ();
     while (k != -1)
     {
+      // Tile points are loaded while the seeds of the tile may be awaited
+      waitSeedRows (k / cot + 1);
       if (cfg.isVerboseOn ())
         std::cout << "  --> Tile " << k << " (" << k % cot << ", " << k / cot
-                  << ") : " << out_seeds[k].size () << " seeds" << std::endl;
-      it = out_seeds[k].begin ();
-      while (it != out_seeds[k].end ())
+                  << ") : " << (seeds_in.isOpen () ? seeds_in.tileSize (k)
+                                  : (int) (out_seeds[k].size ()))
+                  << " seeds" << std::endl;
+      nbdet += processTileSeeds (k, false, num, unused, nbdup);
+      int nbouts = ctdet->getOuts ();
+      ctdet->resetOuts ();
+      for (int w = 0; w < (int) (asd_workers.size ()); w++)
       {
-        Pt2i p1 (*it++);
-        Pt2i p2 (*it++);
-        Pt2i center ((p1.x () + p2.x ()) / 2, (p1.y () + p2.y ()) / 2);
-        if (detection_map->occupied (center)) unused ++;
-        else
-        {
-          CarriageTrack *ct = ctdet->detect (p1, p2);
-          if (ct != NULL && ct->plateau (0) != NULL)
-          {
-            std::vector<std::vector<Pt2i> > pts;
-            if (cfg.isConnectedOn ())
-              ct->getConnectedPoints (&pts, true, vm_width, vm_height, iratio);
-            else ct->getPoints (&pts, true, vm_width, vm_height, iratio);
-            if (detection_map->add (pts))
-            {
-              out_sucseeds[k].push_back (p1);
-              out_sucseeds[k].push_back (p2);
-              if (cfg.isExportOn ())
-              {
-                road_sections.push_back (ct);
-                ctdet->preserveDetection ();
-              }
-            }
-            num ++;
-          }
-        }
+        nbouts += asd_workers[w]->getOuts ();
+        asd_workers[w]->resetOuts ();
       }
-      if (ctdet->getOuts () != 0)
-        std::cout << "  " << ctdet->getOuts () << " requests outside\n"
-                  << std::endl;
-      ctdet->resetOuts ();
+      if (nbouts != 0)
+        std::cout << "  " << nbouts << " requests outside\n" << std::endl;
       k = ptset->nextTile ();
     }
   }
@@ -625,64 +690,511 @@ bool AmrelTool::processAsd ()
   {
     for (int j = 0; j < rot; j++)
     {
+      waitSeedRows (j + 1);
       for (int i = 0; i < cot; i++)
       {
         int k = j * cot + ((j % 2 != 0) ? cot - 1 - i : i);
-        it = out_seeds[k].begin ();
-        while (it != out_seeds[k].end ())
+        nbdet += processTileSeeds (k, true, num, unused, nbdup);
+      }
+    }
+  }
+  for (int w = 0; w < (int) (asd_workers.size ()); w++)
+    delete asd_workers[w];
+  asd_workers.clear ();
+  if (save_seeds)
+  {
+    saveSuccessfulSeeds ();
+    cfg.saveDetectorStatus ();
+  }
+  if (cfg.isVerboseOn ())
+  {
+    if (cfg.isSeedDedupOn ())
+      std::cout << "  " << nbdup << " duplicate seeds eliminated" << std::endl;
+    std::cout << "ASD OK : " << num << " roads and "
+              << unused << " unused seeds" << std::endl;
+    std::cout << "  " << nbdet << " detector calls" << std::endl;
+  }
+  return true;
+}
+
+
+int AmrelTool::processTileSeeds (int k, bool check_connection,
+                                 int &num, int &unused, int &nbdup,
+                                 AsdRegion *reg)
+{
+  int nbdet = 0;
+  std::vector<Pt2i> &seeds = out_seeds[k];
+  if (seeds_in.isOpen ()) seeds_in.getTileSeeds (k, seeds);
+  if (cfg.isSeedDedupOn ()) nbdup += compactSeeds (k);
+  int nbseeds = (int) (seeds.size ()) / 2;
+  AmrelMap *map = (reg != NULL ? reg->map () : detection_map);
+  int nbw = (reg != NULL ? 1 : 1 + (int) (asd_workers.size ()));
+  CTrackSpans *ctpts = new CTrackSpans[nbw];
+  std::mutex map_lock;
+
+  // Each worker detects its next seed while previous ones are committed,
+  //   then commits it in seed order, seed status being updated by the
+  //   previous commits.
+  #pragma omp parallel for schedule (dynamic, 1) ordered \
+                           num_threads (nbw) reduction (+:nbdet)
+  for (int i = 0; i < nbseeds; i++)
+  {
+    const Pt2i &p1 = seeds[2 * i];
+    const Pt2i &p2 = seeds[2 * i + 1];
+    int w = omp_get_thread_num ();
+    CTrackDetector *det = (reg != NULL ? reg->detector () :
+                           (w == 0 ? ctdet : asd_workers[w - 1]));
+    CTrackSpans &spans = ctpts[w];
+    CarriageTrack *ct = NULL;
+
+    // Speculative detection if the seed is not yet discarded
+    map_lock.lock ();
+    bool occupied = seedOccupied (map, p1, p2);
+    map_lock.unlock ();
+    if (! occupied)
+    {
+      ct = det->detect (p1, p2);
+      nbdet ++;
+      if (ct != NULL)
+      {
+        // Only tracks to export are taken from the detector
+        if (cfg.isExportOn ()) det->preserveDetection ();
+        if (ct->plateau (0) != NULL)
         {
-          Pt2i p1 (*it++);
-          Pt2i p2 (*it++);
-          Pt2i center ((p1.x () + p2.x ()) / 2, (p1.y () + p2.y ()) / 2);
-          if (detection_map->occupied (center)) unused ++;
-          else
+          if (cfg.isConnectedOn ())
+            ct->getConnectedPoints (&spans, true,
+                                    vm_width, vm_height, iratio);
+          else ct->getPoints (&spans, true, vm_width, vm_height, iratio);
+        }
+      }
+    }
+
+    #pragma omp ordered
+    {
+      map_lock.lock ();
+      if (seedOccupied (map, p1, p2))
+      {
+        if (reg != NULL) reg->addSuppressedSeed (k, p1, p2);
+        unused ++;
+      }
+      else if (ct != NULL && ct->plateau (0) != NULL)
+      {
+        if (! check_connection || isConnected (spans))
+        {
+          if (reg != NULL)
+          {
+            map->add (spans);
+            reg->addSection (k, p1, p2, spans,
+                             cfg.isExportOn () ? ct : NULL);
+            if (cfg.isExportOn ()) ct = NULL;
+          }
+          else if (map->add (spans))
           {
-            CarriageTrack *ct = ctdet->detect (p1, p2);
-            if (ct != NULL && ct->plateau (0) != NULL)
+            out_sucseeds[k].push_back (p1);
+            out_sucseeds[k].push_back (p2);
+            if (cfg.isExportOn ())
             {
-              std::vector<std::vector<Pt2i> > pts;
-              if (cfg.isConnectedOn ())
-                ct->getConnectedPoints (&pts, true,
-                                        vm_width, vm_height, iratio);
-              else ct->getPoints (&pts, true, vm_width, vm_height, iratio);
-              if (isConnected (pts))
-              {
-                if (detection_map->add (pts))
-                {
-                  out_sucseeds[k].push_back (p1);
-                  out_sucseeds[k].push_back (p2);
-                  if (cfg.isExportOn ())
-                  {
-                    road_sections.push_back (ct);
-                    ctdet->preserveDetection ();
-                  }
-                }
-              }
-              else std::cout << "Road section " << num
-                             << " is not connected" << std::endl;
-              num ++;
+              road_sections.push_back (ct);
+              ct = NULL;
             }
           }
         }
+        else std::cout << "Road section " << num
+                       << " is not connected" << std::endl;
+        num ++;
       }
+      map_lock.unlock ();
+    }
+
+    // Other tracks are recycled by the detector at its next detection
+    if (ct != NULL && cfg.isExportOn ())
+    {
+      ct->release (det->plateauPool ());
+      delete ct;
     }
   }
-  if (save_seeds)
+  delete [] ctpts;
+  if (seeds_in.isOpen ()) std::vector<Pt2i> ().swap (seeds);
+  return nbdet;
+}
+
+
+int AmrelTool::processRegions (int nbr, int &num, int &unused, int &nbdup)
+{
+  int nbdet = 0;
+  int nbouts = 0;
+  int cot = ptset->columnsOfTiles ();
+  if (nbr > cot) nbr = cot;
+  int halo = ptset->bufferSize () / 2;
+  int tpw = vm_width / cot;
+  AsdRegion **regs = new AsdRegion*[nbr];
+
+  #pragma omp parallel for schedule (dynamic, 1) \
+                           reduction (+:nbdet,num,unused,nbdup,nbouts)
+  for (int r = 0; r < nbr; r++)
   {
-    saveSuccessfulSeeds ();
-    cfg.saveDetectorStatus ();
+    // Owned tile columns, and loaded ones with the halo
+    int cmin = (r * cot) / nbr;
+    int cmax = ((r + 1) * cot) / nbr;
+    int lmin = (cmin < halo ? 0 : cmin - halo);
+    int lmax = (cmax + halo > cot ? cot : cmax + halo);
+    IPtTileSet *tset = ptset->createColumnSubset (lmin, lmax);
+    CTrackDetector *det = newTrackDetector ();
+    det->setPointsGrid (tset, vm_width, vm_height, sub_div, csize);
+    int x0 = lmin * tpw;
+    AmrelMap *map = new AmrelMap ((lmax == cot ? vm_width : lmax * tpw) - x0,
+                                  vm_height, &cfg, x0);
+    regs[r] = new AsdRegion (cmin, cmax, tset, det, map);
+
+    tset->createBuffers ();
+    int k = tset->nextTile ();
+    while (k != -1)
+    {
+      if (regs[r]->owns (k % cot))
+      {
+        waitSeedRows (k / cot + 1);
+        nbdet += processTileSeeds (k, false, num, unused, nbdup, regs[r]);
+      }
+      k = tset->nextTile ();
+    }
+    nbouts += det->getOuts ();
+    regs[r]->release ();
   }
-  if (cfg.isVerboseOn ()) std::cout << "ASD OK : " << num << " roads and "
-                                    << unused << " unused seeds" << std::endl;
-  return true;
+  if (nbouts != 0)
+    std::cout << "  " << nbouts << " requests outside\n" << std::endl;
+
+  // Merge of road sections in region order
+  int nbdropped = 0;
+  std::vector<int> rtiles;
+  std::vector<Pt2i> rseeds;
+  for (int r = 0; r < nbr; r++)
+  {
+    int nbsec = regs[r]->countOfSections ();
+    if (cfg.isVerboseOn ())
+      std::cout << "  --> Region " << r << " (tile columns "
+                << regs[r]->firstColumn () << " to "
+                << regs[r]->lastColumn () - 1 << ") : "
+                << nbsec << " road sections" << std::endl;
+    std::vector<bool> dropped (nbsec, false);
+    for (int i = 0; i < nbsec; i++)
+    {
+      const Pt2i &p1 = regs[r]->sectionStart (i);
+      const Pt2i &p2 = regs[r]->sectionEnd (i);
+      if (seedOccupied (detection_map, p1, p2))
+      {
+        dropped[i] = true;
+        num --;
+        unused ++;
+        nbdropped ++;
+      }
+      else if (detection_map->add (regs[r]->sectionSpans (i)))
+      {
+        int k = regs[r]->sectionTile (i);
+        out_sucseeds[k].push_back (p1);
+        out_sucseeds[k].push_back (p2);
+        CarriageTrack *ct = regs[r]->takeSection (i);
+        if (ct != NULL) road_sections.push_back (ct);
+      }
+    }
+
+    // Seeds suppressed by dropped sections are to be retried
+    for (int i = 0; i < regs[r]->countOfSuppressedSeeds (); i++)
+    {
+      int sec = regs[r]->suppressingSection (i);
+      if (sec >= 0 && sec < nbsec && dropped[sec])
+      {
+        rtiles.push_back (regs[r]->suppressedTile (i));
+        rseeds.push_back (regs[r]->suppressedStart (i));
+        rseeds.push_back (regs[r]->suppressedEnd (i));
+      }
+    }
+    delete regs[r];
+  }
+  delete [] regs;
+  if (cfg.isVerboseOn ())
+    std::cout << "  " << nbdropped << " road sections dropped at region borders"
+              << std::endl;
+  if (! rtiles.empty ()) nbdet += retrySeeds (rtiles, rseeds, num, unused);
+  return nbdet;
+}
+
+
+int AmrelTool::retrySeeds (const std::vector<int> &tiles,
+                           const std::vector<Pt2i> &seeds,
+                           int &num, int &unused)
+{
+  int nbdet = 0;
+  int nbrecov = 0;
+  int cot = ptset->columnsOfTiles ();
+  int halo = ptset->bufferSize () / 2;
+  int nbs = (int) (tiles.size ());
+
+  // Only tile columns of retried seeds are loaded, with the halo
+  int cmin = cot, cmax = 0;
+  for (int i = 0; i < nbs; i++)
+  {
+    if (tiles[i] % cot < cmin) cmin = tiles[i] % cot;
+    if (tiles[i] % cot >= cmax) cmax = tiles[i] % cot + 1;
+  }
+  int lmin = (cmin < halo ? 0 : cmin - halo);
+  int lmax = (cmax + halo > cot ? cot : cmax + halo);
+  IPtTileSet *tset = ptset->createColumnSubset (lmin, lmax);
+  CTrackDetector *det = newTrackDetector ();
+  det->setPointsGrid (tset, vm_width, vm_height, sub_div, csize);
+  CTrackSpans spans;
+
+  tset->createBuffers ();
+  int k = tset->nextTile ();
+  while (k != -1)
+  {
+    for (int i = 0; i < nbs; i++)
+    {
+      if (tiles[i] != k) continue;
+      const Pt2i &p1 = seeds[2 * i];
+      const Pt2i &p2 = seeds[2 * i + 1];
+      if (seedOccupied (detection_map, p1, p2)) continue;
+      unused --;
+      CarriageTrack *ct = det->detect (p1, p2);
+      nbdet ++;
+      if (ct != NULL && ct->plateau (0) != NULL)
+      {
+        if (cfg.isExportOn ()) det->preserveDetection ();
+        if (cfg.isConnectedOn ())
+          ct->getConnectedPoints (&spans, true, vm_width, vm_height, iratio);
+        else ct->getPoints (&spans, true, vm_width, vm_height, iratio);
+        if (detection_map->add (spans))
+        {
+          out_sucseeds[k].push_back (p1);
+          out_sucseeds[k].push_back (p2);
+          if (cfg.isExportOn ())
+          {
+            road_sections.push_back (ct);
+            ct = NULL;
+          }
+          nbrecov ++;
+        }
+        num ++;
+        if (ct != NULL && cfg.isExportOn ())
+        {
+          ct->release (det->plateauPool ());
+          delete ct;
+        }
+      }
+    }
+    k = tset->nextTile ();
+  }
+  delete det;
+  delete tset;
+  if (cfg.isVerboseOn ())
+    std::cout << "  " << nbs << " seeds retried at region borders : "
+              << nbrecov << " road sections recovered" << std::endl;
+  return nbdet;
+}
+
+
+bool AmrelTool::seedOccupied (const AmrelMap *map, const Pt2i &p1,
+                              const Pt2i &p2) const
+{
+  Pt2i center ((p1.x () + p2.x ()) / 2, (p1.y () + p2.y ()) / 2);
+  return (map->occupied (center));
+}
+
+
+void AmrelTool::rankSeeds (const std::vector<Pt2i> &seeds,
+                           std::vector<int> &order) const
+{
+  int nbseeds = (int) (seeds.size ()) / 2;
+  std::vector<int> runs;
+  seedRuns (seeds, runs);
+  std::vector<std::pair<int,int> > keys;
+  keys.reserve (nbseeds);
+  for (int i = 0; i < nbseeds; i++)
+    keys.push_back (std::pair<int,int> (- runs[i], i));
+  std::sort (keys.begin (), keys.end ());
+  order.clear ();
+  std::vector<std::pair<int,int> >::iterator it = keys.begin ();
+  while (it != keys.end ()) order.push_back ((it++)->second);
+}
+
+
+void AmrelTool::seedRuns (const std::vector<Pt2i> &seeds,
+                          std::vector<int> &runs) const
+{
+  int nbseeds = (int) (seeds.size ()) / 2;
+  int maxd = 2 * (cfg.seedShift () + 1);
+  maxd *= maxd;
+  runs.assign (nbseeds, 0);
+  int start = 0;
+  for (int i = 1; i <= nbseeds; i++)
+  {
+    bool same = false;
+    if (i != nbseeds)
+    {
+      const Pt2i &a1 = seeds[2 * i - 2], &a2 = seeds[2 * i - 1];
+      const Pt2i &b1 = seeds[2 * i], &b2 = seeds[2 * i + 1];
+      int dvx = (b2.x () - b1.x ()) - (a2.x () - a1.x ());
+      int dvy = (b2.y () - b1.y ()) - (a2.y () - a1.y ());
+      int dcx = (b1.x () + b2.x ()) - (a1.x () + a2.x ());
+      int dcy = (b1.y () + b2.y ()) - (a1.y () + a2.y ());
+      same = (dvx >= -1 && dvx <= 1 && dvy >= -1 && dvy <= 1
+              && dcx * dcx + dcy * dcy <= maxd);
+    }
+    if (! same)
+    {
+      for (int j = start; j < i; j++) runs[j] = i - start;
+      start = i;
+    }
+  }
+}
+
+
+int AmrelTool::compactSeeds (int k)
+{
+  int nbdup = 0;
+  int tol = cfg.seedWidth () / 4;
+  int tol2 = 4 * tol * tol;   // centres are compared with doubled coordinates
+  std::vector<Pt2i> &seeds = out_seeds[k];
+  int nbseeds = (int) (seeds.size ()) / 2;
+  if (nbseeds < 2) return 0;
+
+  // Grid of kept seeds over the centres bounding box
+  int xmin = seeds[0].x () + seeds[1].x (), xmax = xmin;
+  int ymin = seeds[0].y () + seeds[1].y (), ymax = ymin;
+  for (int i = 1; i < nbseeds; i++)
+  {
+    int cx = seeds[2 * i].x () + seeds[2 * i + 1].x ();
+    int cy = seeds[2 * i].y () + seeds[2 * i + 1].y ();
+    if (cx < xmin) xmin = cx;
+    else if (cx > xmax) xmax = cx;
+    if (cy < ymin) ymin = cy;
+    else if (cy > ymax) ymax = cy;
+  }
+  int csz = 2 * tol;
+  int gw = (xmax - xmin) / csz + 1;
+  int gh = (ymax - ymin) / csz + 1;
+  std::vector<int> head (gw * gh, -1);
+  std::vector<int> next (nbseeds, -1);
+  std::vector<bool> kept (nbseeds, false);
+
+  // Seeds of longer segments are kept first
+  std::vector<int> order;
+  rankSeeds (seeds, order);
+  for (int i = 0; i < nbseeds; i++)
+  {
+    int s = order[i];
+    const Pt2i &p1 = seeds[2 * s], &p2 = seeds[2 * s + 1];
+    int cx = p1.x () + p2.x (), cy = p1.y () + p2.y ();
+    long vx = p2.x () - p1.x (), vy = p2.y () - p1.y ();
+    long n1 = vx * vx + vy * vy;
+    int gx = (cx - xmin) / csz, gy = (cy - ymin) / csz;
+    bool dup = false;
+    for (int j = (gy == 0 ? 0 : gy - 1); ! dup && j <= gy + 1 && j < gh; j++)
+      for (int l = (gx == 0 ? 0 : gx - 1); ! dup && l <= gx + 1 && l < gw;
+           l++)
+      {
+        int t = head[j * gw + l];
+        while (! dup && t != -1)
+        {
+          const Pt2i &q1 = seeds[2 * t], &q2 = seeds[2 * t + 1];
+          int dx = q1.x () + q2.x () - cx, dy = q1.y () + q2.y () - cy;
+          if (dx * dx + dy * dy <= tol2)
+          {
+            long wx = q2.x () - q1.x (), wy = q2.y () - q1.y ();
+            long dot = vx * wx + vy * wy;
+            // directions within about 18 degrees
+            dup = (10 * dot * dot >= 9 * n1 * (wx * wx + wy * wy));
+          }
+          t = next[t];
+        }
+      }
+    if (dup) nbdup ++;
+    else
+    {
+      kept[s] = true;
+      next[s] = head[gy * gw + gx];
+      head[gy * gw + gx] = s;
+    }
+  }
+
+  // Removes duplicates, keeping seed order
+  int nbk = 0;
+  for (int i = 0; i < nbseeds; i++)
+    if (kept[i])
+    {
+      seeds[2 * nbk].set (seeds[2 * i]);
+      seeds[2 * nbk + 1].set (seeds[2 * i + 1]);
+      nbk ++;
+    }
+  seeds.resize (2 * nbk);
+  return nbdup;
+}
+
+
+int AmrelTool::dropPadDuplicates (int k, int nbprev)
+{
+  int csz = cfg.seedWidth ();   // grid cell size in doubled coordinates
+  std::vector<Pt2i> &seeds = out_seeds[k];
+  int nbseeds = (int) (seeds.size ()) / 2;
+
+  // Grid of the seeds of previous pads over their centres bounding box
+  int xmin = seeds[0].x () + seeds[1].x (), xmax = xmin;
+  int ymin = seeds[0].y () + seeds[1].y (), ymax = ymin;
+  for (int i = 1; i < nbprev; i++)
+  {
+    int cx = seeds[2 * i].x () + seeds[2 * i + 1].x ();
+    int cy = seeds[2 * i].y () + seeds[2 * i + 1].y ();
+    if (cx < xmin) xmin = cx;
+    else if (cx > xmax) xmax = cx;
+    if (cy < ymin) ymin = cy;
+    else if (cy > ymax) ymax = cy;
+  }
+  int gw = (xmax - xmin) / csz + 1;
+  int gh = (ymax - ymin) / csz + 1;
+  std::vector<int> head (gw * gh, -1);
+  std::vector<int> next (nbprev, -1);
+  for (int i = 0; i < nbprev; i++)
+  {
+    int g = ((seeds[2 * i].y () + seeds[2 * i + 1].y () - ymin) / csz) * gw
+            + (seeds[2 * i].x () + seeds[2 * i + 1].x () - xmin) / csz;
+    next[i] = head[g];
+    head[g] = i;
+  }
+
+  // New seeds identical to a seed of a previous pad are removed
+  int nbk = nbprev;
+  for (int i = nbprev; i < nbseeds; i++)
+  {
+    const Pt2i &p1 = seeds[2 * i], &p2 = seeds[2 * i + 1];
+    int cx = p1.x () + p2.x (), cy = p1.y () + p2.y ();
+    bool dup = false;
+    if (cx >= xmin && cx <= xmax && cy >= ymin && cy <= ymax)
+    {
+      int t = head[((cy - ymin) / csz) * gw + (cx - xmin) / csz];
+      while (! dup && t != -1)
+      {
+        dup = (p1.equals (seeds[2 * t]) && p2.equals (seeds[2 * t + 1]));
+        t = next[t];
+      }
+    }
+    if (! dup)
+    {
+      seeds[2 * nbk].set (p1);
+      seeds[2 * nbk + 1].set (p2);
+      nbk ++;
+    }
+  }
+  seeds.resize (2 * nbk);
+  return (nbseeds - nbk);
 }
 
 
-bool AmrelTool::processSawing ()
+
+bool AmrelTool::processSawing (bool streamed_asd)
 {
   if (cfg.padSize () == 0)
   {
     if (! loadTileSet (true, false)) return false;
+    if (streamed_asd) startStreamedAsd ();
     processShading ();
     clearDtm ();
     if (! cfg.rorpoSkipped ())
@@ -769,6 +1281,7 @@ bool AmrelTool::processSawing ()
     rorpo_map = new unsigned char[pad_w * dtm_w * pad_h * dtm_h];
   out_seeds =
     new std::vector<Pt2i>[ptset->columnsOfTiles() * ptset->rowsOfTiles()];
+  if (streamed_asd) startStreamedAsd ();
 
   // Creates seed map
   int k = dtm_in->nextPad (dtm_map);
@@ -789,6 +1302,8 @@ bool AmrelTool::processSawing ()
     clearSobel ();
     processSeeds (k);
     clearFbsd ();
+    // Next pads can only bring seeds in the pad rows and above
+    if (streamed_asd) releaseSeedRows (k / ptset->columnsOfTiles ());
     k = dtm_in->nextPad (dtm_map);
   }
   if (! cfg.rorpoSkipped ()) clearRorpo ();
@@ -797,6 +1312,50 @@ bool AmrelTool::processSawing ()
 }
 
 
+bool AmrelTool::endStreamedAsd ()
+{
+  if (asd_thread == NULL) return false;
+  releaseSeedRows (ptset->rowsOfTiles ());
+  asd_thread->join ();
+  delete asd_thread;
+  asd_thread = NULL;
+  seed_rows = -1;
+  return asd_ok;
+}
+
+
+void AmrelTool::startStreamedAsd ()
+{
+  seed_rows = 0;
+  asd_ok = false;
+  asd_thread = new std::thread (&AmrelTool::streamedAsd, this);
+}
+
+
+void AmrelTool::streamedAsd ()
+{
+  asd_ok = processAsd ();
+}
+
+
+void AmrelTool::releaseSeedRows (int nb)
+{
+  std::lock_guard<std::mutex> lock (seed_mutex);
+  if (nb > seed_rows)
+  {
+    seed_rows = nb;
+    seed_cond.notify_all ();
+  }
+}
+
+
+void AmrelTool::waitSeedRows (int nb)
+{
+  std::unique_lock<std::mutex> lock (seed_mutex);
+  while (seed_rows != -1 && seed_rows < nb) seed_cond.wait (lock);
+}
+
+
 bool AmrelTool::saveShadingMap ()
 {
   std::string name (AmrelConfig::RES_DIR + AmrelConfig::SLOPE_FILE
@@ -925,24 +1484,19 @@ bool AmrelTool::saveFbsdSegments ()
 {
   std::string name (AmrelConfig::RES_DIR + AmrelConfig::FBSD_FILE
                     + AmrelConfig::FBSD_SUFFIX);
-  std::ofstream fbsd_out (name.c_str (), std::ios::out);
-  if (! fbsd_out.is_open ())
+  DssWriter fbsd_out;
+  if (! fbsd_out.open (name, vm_width, vm_height, csize))
   {
     std::cout << "Can't save FBSD segments in " << name << std::endl;
     return false;
   }
-  fbsd_out.write ((char *) (&vm_width), sizeof (int));
-  fbsd_out.write ((char *) (&vm_height), sizeof (int));
-  fbsd_out.write ((char *) (&csize), sizeof (float));
-  int nb = 0;
-  DigitalStraightSegment *ds
-    = new DigitalStraightSegment[(int) (dss.size ())];
   std::vector<DigitalStraightSegment>::iterator it = dss.begin ();
-  while (it != dss.end ()) ds[nb++].set (*it++);
-  fbsd_out.write ((char *) (&nb), sizeof (int));
-  fbsd_out.write ((char *) ds, nb * sizeof (DigitalStraightSegment));
-  fbsd_out.close ();
-  delete [] ds;
+  while (it != dss.end ()) fbsd_out.write (*it++);
+  if (! fbsd_out.close ())
+  {
+    std::cout << "Can't save FBSD segments in " << name << std::endl;
+    return false;
+  }
   return true;
 }
 
@@ -951,23 +1505,23 @@ bool AmrelTool::loadFbsdSegments ()
 {
   std::string name (AmrelConfig::RES_DIR + AmrelConfig::FBSD_FILE
                     + AmrelConfig::FBSD_SUFFIX);
-  std::ifstream fbsd_in (name.c_str (), std::ios::in);
-  if (! fbsd_in.is_open ())
+  DssReader fbsd_in;
+  if (! fbsd_in.open (name))
   {
-    std::cout << name << ": can't be opened" << std::endl;
+    std::cout << name << ": can't be opened or obsolete format" << std::endl;
+    return false;
+  }
+  vm_width = fbsd_in.width ();
+  vm_height = fbsd_in.height ();
+  csize = fbsd_in.cellSize ();
+  if (fbsd_in.size () > 0) dss.reserve (dss.size () + fbsd_in.size ());
+  DigitalStraightSegment ds;
+  while (fbsd_in.read (ds)) dss.push_back (ds);
+  if (! fbsd_in.close ())
+  {
+    std::cout << name << ": truncated file" << std::endl;
     return false;
   }
-  fbsd_in.read ((char *) (&vm_width), sizeof (int));
-  fbsd_in.read ((char *) (&vm_height), sizeof (int));
-  fbsd_in.read ((char *) (&csize), sizeof (float));
-  int nb = 0;
-  fbsd_in.read ((char *) (&nb), sizeof (int));
-  char *dss_in = new char[nb * sizeof (DigitalStraightSegment)];
-  fbsd_in.read ((char *) dss_in, nb * sizeof (DigitalStraightSegment));
-  fbsd_in.close ();
-  DigitalStraightSegment *ds = (DigitalStraightSegment *) dss_in;
-  for (int i = 0; i < nb; i++) dss.push_back (*ds++);
-  delete [] dss_in;
   return true;
 }
 
@@ -978,28 +1532,8 @@ bool AmrelTool::saveSeeds ()
                     + AmrelConfig::SEED_SUFFIX);
   if (cfg.isVerboseOn ())
     std::cout << "Saving seeds in " << name << std::endl;
-  std::ofstream seeds_out (name.c_str (), std::ios::out);
-  if (! seeds_out.is_open ())
-  {
-    std::cout << "Can't save seeds in " << name << std::endl;
-    return false;
-  }
-  int nb = 0, rot = ptset->rowsOfTiles (), cot = ptset->columnsOfTiles ();
-  int vmw = vm_width, vmh = vm_height, vmc = cot, vmr = rot;
-  float vms = csize;
-  if (cfg.isHalfSizeSeedsOn ())
-  {
-    vmw *= 2;
-    vmh *= 2;
-    vmc *= 2;
-    vmr *= 2;
-    vms /= 2;
-  }
-  seeds_out.write ((char *) (&vmw), sizeof (int));
-  seeds_out.write ((char *) (&vmh), sizeof (int));
-  seeds_out.write ((char *) (&vms), sizeof (float));
-  seeds_out.write ((char *) (&vmc), sizeof (int));
-  seeds_out.write ((char *) (&vmr), sizeof (int));
+  int rot = ptset->rowsOfTiles (), cot = ptset->columnsOfTiles ();
+  bool saved = false;
   if (cfg.isHalfSizeSeedsOn ())
   {
     int kx = -1, ky = -1;
@@ -1036,49 +1570,14 @@ bool AmrelTool::saveSeeds ()
       }
     }
     if (outl != 0) std::cout << outl << " ousiders when retiling" << std::endl;
-    for (int i = 0; i < cot * rot * 4; i++) nb += (int) (reseeds[i].size ());
-    seeds_out.write ((char *) (&nb), sizeof (int));
-    numk = 0;
-    for (int j = 0; j < rot * 2; j++)
-    {
-      for (int i = 0; i < cot * 2; i ++)
-      {
-        it = reseeds[numk].begin ();
-        while (it != reseeds[numk].end ())
-        {
-          Pt2i pt1 (*it++);
-          Pt2i pt2 (*it++);
-          seeds_out.write ((char *) &pt1, sizeof (Pt2i));
-          seeds_out.write ((char *) &pt2, sizeof (Pt2i));
-        }
-        numk ++;
-      }
-    }
+    saved = SeedFile::save (name, vm_width * 2, vm_height * 2, csize / 2,
+                            cot * 2, rot * 2, reseeds);
     delete [] reseeds;
   }
-  else
-  {
-    for (int i = 0; i < cot * rot; i++) nb += (int) (out_seeds[i].size ());
-    seeds_out.write ((char *) (&nb), sizeof (int));
-    std::vector<Pt2i>::iterator it;
-    for (int j = 0; j < rot; j++)
-    {
-      for (int i = 0; i < cot; i ++)
-      {
-        int k = j * cot + ((j % 2 != 0) ? cot - 1 - i : i);
-        it = out_seeds[k].begin ();
-        while (it != out_seeds[k].end ())
-        {
-          Pt2i pt1 (*it++);
-          Pt2i pt2 (*it++);
-          seeds_out.write ((char *) &pt1, sizeof (Pt2i));
-          seeds_out.write ((char *) &pt2, sizeof (Pt2i));
-        }
-      }
-    }
-  }
-  seeds_out.close ();
-  return true;
+  else saved = SeedFile::save (name, vm_width, vm_height, csize,
+                               cot, rot, out_seeds);
+  if (! saved) std::cout << "Can't save seeds in " << name << std::endl;
+  return saved;
 }
 
 
@@ -1086,43 +1585,18 @@ bool AmrelTool::loadSeeds ()
 {
   std::string name (AmrelConfig::RES_DIR + AmrelConfig::SEED_FILE
                     + AmrelConfig::SEED_SUFFIX);
-  std::ifstream seeds_in (name.c_str (), std::ios::in);
-  if (! seeds_in.is_open ())
+  if (! seeds_in.open (name))
   {
-    std::cout << name << ": can't be opened" << std::endl;
+    std::cout << name << ": can't be opened or unknown format" << std::endl;
     return false;
   }
   if (cfg.isVerboseOn ())
     std::cout << "Loading seeds from " << name << std::endl;
-  int tsw = 1, tsh = 1, nb = 0;
-  seeds_in.read ((char *) (&vm_width), sizeof (int));
-  seeds_in.read ((char *) (&vm_height), sizeof (int));
-  seeds_in.read ((char *) (&csize), sizeof (float));
-  seeds_in.read ((char *) (&tsw), sizeof (int));
-  seeds_in.read ((char *) (&tsh), sizeof (int));
-  seeds_in.read ((char *) (&nb), sizeof (int));
-  Pt2i *pts = new Pt2i[nb];
-  seeds_in.read ((char *) pts, nb * sizeof (Pt2i));
-  seeds_in.close ();
-
-  out_seeds = new std::vector<Pt2i>[tsh * tsw];
-  int tw = vm_width / tsw;
-  int th = vm_height / tsh;
-  Pt2i *ppts = pts;
-  for (int i = 0; i < nb; i += 2)
-  {
-    Pt2i pt1 = *ppts++;
-    Pt2i pt2 = *ppts++;
-    int tilex = ((pt1.x () + pt2.x ()) / 2) / tw;
-    if (tilex < 0) tilex = 0;
-    else if (tilex >= tsw) tilex = tsw - 1;
-    int tiley = ((pt1.y () + pt2.y ()) / 2) / th;
-    if (tiley < 0) tiley = 0;
-    else if (tiley >= tsh) tiley = tsh - 1;
-    out_seeds[tiley * tsw + tilex].push_back (pt1);
-    out_seeds[tiley * tsw + tilex].push_back (pt2);
-  }
-  delete [] pts;
+  vm_width = seeds_in.width ();
+  vm_height = seeds_in.height ();
+  csize = seeds_in.cellSize ();
+  int nbt = seeds_in.columnsOfTiles () * seeds_in.rowsOfTiles ();
+  out_seeds = new std::vector<Pt2i>[nbt];
   return true;
 }
 
@@ -1397,9 +1871,9 @@ void AmrelTool::saveFbsdImage (int im_w, int im_h)
         nok = ((red + green + blue) > 300);     // < 300 si fond noir
       }
       pim = im.get_pointer ();
-      std::vector<Pt2i> pts = (*it)->getAllPoints ();
-      std::vector<Pt2i>::iterator pit = pts.begin ();
-      while (pit != pts.end ())
+      const Pt2i *pit = (*it)->getPoints ();
+      const Pt2i *pend = pit + (*it)->size ();
+      while (pit != pend)
       {
         *(pim + pit->y () * im_w + pit->x ())
                   = (unsigned int) (red + green * 256 + blue * 256 * 256);
@@ -1432,9 +1906,9 @@ void AmrelTool::saveFbsdImage (int im_w, int im_h)
     while (it != bss.end ())
     {
       pim = im.get_pointer ();
-      std::vector<Pt2i> pts = (*it)->getAllPoints ();
-      std::vector<Pt2i>::iterator pit = pts.begin ();
-      while (pit != pts.end ())
+      const Pt2i *pit = (*it)->getPoints ();
+      const Pt2i *pend = pit + (*it)->size ();
+      while (pit != pend)
       {
         *(pim + pit->y () * im_w + pit->x ()) = (unsigned char) 0;
         pit ++;
@@ -1613,15 +2087,16 @@ int AmrelTool::countRoadPixels ()
 }
 
 
-bool AmrelTool::isConnected (std::vector<std::vector<Pt2i> > &pts) const
+bool AmrelTool::isConnected (const CTrackSpans &spans) const
 {
-  (void) pts;
+  (void) spans;
   return true;
 }
 
 
-void AmrelTool::adaptTrackDetector ()
+void AmrelTool::adaptTrackDetector (CTrackDetector *det)
 {
   if (cfg.tailMinSizeDefined ())
-    ctdet->model()->setTailMinSize (cfg.tailMinSize ());
+    det->model()->setTailMinSize (cfg.tailMinSize ());
+  det->recordDisplayScans (cfg.isExportOn ());
 }
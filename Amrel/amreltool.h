@@ -22,11 +22,16 @@
 #ifndef AMREL_TOOL_H
 #define AMREL_TOOL_H
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "terrainmap.h"
 #include "vmap.h"
 #include "bsdetector.h"
 #include "amrelconfig.h"
 #include "amrelmap.h"
+#include "asdregion.h"
+#include "seedfile.h"
 /* SPEC AMRELnet
 #include "image.hpp"
 // FIN SPEC */
@@ -68,6 +73,7 @@ public:
   static const unsigned int HUE_BLUE;
 
 
+
   /**
    * \brief Creates an AMREL tool.
    */
@@ -138,11 +144,21 @@ public:
    */
   inline AmrelConfig *config () { return &cfg; }
 
+  /**
+   * Returns the blurred segment detector.
+   */
+  inline BSDetector *segmentDetector () { return &bsdet; }
+
   /**
    * Associates a track detector to the automatic one.
    */
   void addTrackDetector ();
 
+  /**
+   * Creates a new track detector set for automatic road extraction.
+   */
+  CTrackDetector *newTrackDetector ();
+
   /**
    * Edits road detector features.
    */
@@ -211,8 +227,19 @@ public:
   /**
    * Detects roads on loaded image : steps 1 to 5 = generating seeds.
    * Returns if succeeded (false when tiles can not be loaded).
+   * @param streamed_asd Runs road extraction concurrently (see endStreamedAsd).
    */
-  bool processSawing ();
+  bool processSawing (bool streamed_asd = false);
+
+  /**
+   * Waits for the end of road extraction started in streaming mode.
+   * In streaming mode, road extraction runs in a separate thread started
+   *   once the tile set is known. Tiles are processed as soon as no more
+   *   pad can bring seeds into their row, in the same order as processAsd.
+   * With tile buffers, the points of the next tile are loaded meanwhile.
+   * Returns if extraction succeeded (false if it was not started).
+   */
+  bool endStreamedAsd ();
 
   /**
    * Saves DTM shaded map in steps/shade.map file.
@@ -260,7 +287,8 @@ public:
   bool saveSeeds ();
 
   /**
-   * Loads blurred-segment-based seeds from steps/seeds.pts file to run ASD.
+   * Opens steps/seeds.pts file of blurred-segment-based seeds to run ASD.
+   * The seeds of each tile are only read when the tile is processed.
    */
   bool loadSeeds ();
 
@@ -379,11 +407,17 @@ private:
   std::vector<DigitalStraightSegment> dss;
   /** Produced seeds for road detection. */
   std::vector<Pt2i> *out_seeds;
+  /** Seed file providing the seeds of each processed tile, if open. */
+  SeedFile seeds_in;
+  /** Per chunk and tile buckets of seeds, reused by seed generation. */
+  std::vector<std::vector<Pt2i> > seed_buckets;
   /** Successful seeds for road detection. */
   std::vector<Pt2i> *out_sucseeds;
 
   /** Road detector. */
   CTrackDetector *ctdet;
+  /** Additional road detectors of parallel road extraction workers. */
+  std::vector<CTrackDetector *> asd_workers;
   /** List of detected road sections. */
   std::vector<CarriageTrack *> road_sections;
   /** Map of detected roads. */
@@ -392,14 +426,151 @@ private:
   /** Connection seeds between connected components (for AMRELnet). */
   std::vector<Pt2i> connection_seeds;
 
+  /** Road extraction thread in streaming mode. */
+  std::thread *asd_thread;
+  /** Road extraction status in streaming mode. */
+  bool asd_ok;
+  /** Count of tile rows with final seeds (-1 if all seeds are available). */
+  int seed_rows;
+  /** Lock on the count of tile rows with final seeds. */
+  std::mutex seed_mutex;
+  /** Signal of new tile rows with final seeds. */
+  std::condition_variable seed_cond;
+
 
   /**
    * Completes the track detector features with application needs.
    * Differenciation with AMRELnet.
+   * @param det Track detector to complete.
    */
-  void adaptTrackDetector ();
+  void adaptTrackDetector (CTrackDetector *det);
 
-bool isConnected (std::vector<std::vector<Pt2i> > &pts) const;
+  /**
+   * Checks the connectivity of a detected road.
+   * Placeholder for AMRELnet. Accepts all the roads here.
+   * @param spans Pixel runs of the detected road.
+   */
+  bool isConnected (const CTrackSpans &spans) const;
+
+  /**
+   * Detects roads from the seeds of a tile.
+   * Each parallel worker detects its next seed in advance, then adds the
+   *   successful detection to the detection map in seed order. Those whose
+   *   seed got meanwhile covered by a previous one are discarded.
+   * Workers only wait for each other at the end of the tile.
+   * In a region of parallel extraction, the region detector and map are used
+   *   and successful detections are recorded in the region for a later merge.
+   * Seeds read from the seed file are only kept during tile processing.
+   * Returns the count of detector calls.
+   * @param k Tile index.
+   * @param check_connection Rejects roads with disconnected parts if set.
+   * @param num Count of detected roads to update.
+   * @param unused Count of unused seeds to update.
+   * @param nbdup Count of eliminated duplicate seeds to update.
+   * @param reg Region of parallel extraction (NULL for the whole map).
+   */
+  int processTileSeeds (int k, bool check_connection, int &num, int &unused,
+                        int &nbdup, AsdRegion *reg = NULL);
+
+  /**
+   * Detects roads from the seeds of a buffered tile set split into regions.
+   * Each region of tile columns is processed by an independent worker,
+   *   with its own tile buffers, detector and partial detection map.
+   * The road sections of all regions are then merged in region order,
+   *   discarding those whose seed is covered by a previously merged one.
+   * Seeds suppressed in their region by a discarded section are retried
+   *   against the merged map, so that no road is lost at region borders.
+   * As detection order still differs at region borders, roads found there
+   *   may slightly differ from a single sweep.
+   * Returns the count of detector calls.
+   * @param nbr Count of regions.
+   * @param num Count of detected roads to update.
+   * @param unused Count of unused seeds to update.
+   * @param nbdup Count of eliminated duplicate seeds to update.
+   */
+  int processRegions (int nbr, int &num, int &unused, int &nbdup);
+
+  /**
+   * Retries seeds suppressed by road sections dropped at region borders.
+   * Seeds are detected in tile order against the merged detection map,
+   *   in a sequential pass over their tile columns and halo.
+   * Returns the count of detector calls.
+   * @param tiles Tiles of the seeds.
+   * @param seeds Seeds to retry (pairs of stroke ends).
+   * @param num Count of detected roads to update.
+   * @param unused Count of unused seeds to update.
+   */
+  int retrySeeds (const std::vector<int> &tiles,
+                  const std::vector<Pt2i> &seeds, int &num, int &unused);
+
+  /**
+   * Returns whether the center of a seed lies on an already detected road.
+   * As the detection map only grows, an occupied seed remains so.
+   * @param map Detection map.
+   * @param p1 Seed first end.
+   * @param p2 Seed second end.
+   */
+  bool seedOccupied (const AmrelMap *map, const Pt2i &p1, const Pt2i &p2) const;
+
+  /**
+   * Sorts the seeds of a tile by decreasing length of their source segment.
+   * The segment of a seed is recovered as its run of seeds (see seedRuns).
+   * @param seeds Seeds of the tile (pairs of stroke ends).
+   * @param order Provided seed indices in processing order.
+   */
+  void rankSeeds (const std::vector<Pt2i> &seeds,
+                  std::vector<int> &order) const;
+
+  /**
+   * Sets for each seed of a tile the length of its run of seeds.
+   * A run is a sequence of consecutive seeds with the same stroke shifted
+   *   along a straight segment.
+   * @param seeds Seeds of the tile (pairs of stroke ends).
+   * @param runs Provided run length of each seed.
+   */
+  void seedRuns (const std::vector<Pt2i> &seeds, std::vector<int> &runs) const;
+
+  /**
+   * Removes near-identical seeds of a tile before road detection.
+   * Seeds are hashed in a grid by their center, and a seed is dropped
+   *   if a seed of a longer run was kept with a close center and a
+   *   similar direction.
+   * Returns the count of eliminated seeds.
+   * @param k Tile index.
+   */
+  int compactSeeds (int k);
+
+  /**
+   * Removes the last produced seeds of a tile already found by previous pads.
+   * Overlapping pads detect the same segments, and thus often produce the
+   *   same seeds, which would give the same road detection.
+   * Returns the count of eliminated seeds.
+   * @param k Tile index.
+   * @param nbprev Count of seeds of the tile provided by previous pads.
+   */
+  int dropPadDuplicates (int k, int nbprev);
+
+  /**
+   * Starts road extraction in a separate thread (streaming mode).
+   */
+  void startStreamedAsd ();
+
+  /**
+   * Runs road extraction and keeps its status (streaming mode).
+   */
+  void streamedAsd ();
+
+  /**
+   * Signals that seeds of the first tile rows are final (streaming mode).
+   * @param nb Count of tile rows with final seeds.
+   */
+  void releaseSeedRows (int nb);
+
+  /**
+   * Waits until seeds of the first tile rows are final.
+   * @param nb Count of required tile rows.
+   */
+  void waitSeedRows (int nb);
 
 };
 #endif
@@ -0,0 +1,83 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "asdregion.h"
+
+
+AsdRegion::AsdRegion (int cmin, int cmax,
+                      IPtTileSet *tset, CTrackDetector *det, AmrelMap *map)
+{
+  col_min = cmin;
+  col_max = cmax;
+  ptset = tset;
+  ctdet = det;
+  detection_map = map;
+}
+
+
+AsdRegion::~AsdRegion ()
+{
+  release ();
+  for (int i = 0; i < (int) (tracks.size ()); i++)
+    if (tracks[i] != NULL) delete tracks[i];
+}
+
+
+void AsdRegion::release ()
+{
+  if (ptset != NULL) delete ptset;
+  ptset = NULL;
+  if (ctdet != NULL) delete ctdet;
+  ctdet = NULL;
+  if (detection_map != NULL) delete detection_map;
+  detection_map = NULL;
+}
+
+
+void AsdRegion::addSection (int k, const Pt2i &p1, const Pt2i &p2,
+                            CTrackSpans &spans, CarriageTrack *ct)
+{
+  tiles.push_back (k);
+  seeds.push_back (p1);
+  seeds.push_back (p2);
+  this->spans.push_back (CTrackSpans ());
+  this->spans.back().swap (spans);
+  tracks.push_back (ct);
+}
+
+
+CarriageTrack *AsdRegion::takeSection (int i)
+{
+  CarriageTrack *ct = tracks[i];
+  tracks[i] = NULL;
+  return ct;
+}
+
+
+void AsdRegion::addSuppressedSeed (int k, const Pt2i &p1, const Pt2i &p2)
+{
+  // Each section is added once to the region map, road numbers start at 1
+  Pt2i center ((p1.x () + p2.x ()) / 2, (p1.y () + p2.y ()) / 2);
+  sup_tiles.push_back (k);
+  sup_seeds.push_back (p1);
+  sup_seeds.push_back (p2);
+  sup_sections.push_back (detection_map->roadAt (center) - 1);
+}
@@ -0,0 +1,215 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef ASD_REGION_H
+#define ASD_REGION_H
+
+#include <vector>
+#include "pt2i.h"
+#include "ipttileset.h"
+#include "ctrackdetector.h"
+#include "amrelmap.h"
+
+
+/** 
+ * @class AsdRegion asdregion.h
+ * \brief Region of road extraction run by an independent worker.
+ * A region owns a range of tile columns. Its worker loads the owned tiles
+ *   and a halo of neighbour tiles in its own tile set buffers, and records
+ *   the detected road sections in its own partial detection map.
+ * Road sections are kept in detection order for a later merge.
+ */
+class AsdRegion
+{
+public:
+
+  /**
+   * \brief Creates a region of road extraction.
+   * The region takes the ownership of provided tile set, detector and map.
+   * @param cmin First owned tile column.
+   * @param cmax Last owned tile column + 1.
+   * @param tset Tile set of owned and halo tiles.
+   * @param det Road detector working on the region tile set.
+   * @param map Partial detection map covering owned and halo tiles.
+   */
+  AsdRegion (int cmin, int cmax,
+             IPtTileSet *tset, CTrackDetector *det, AmrelMap *map);
+
+  /**
+   * \brief Deletes the region and its remaining road sections.
+   */
+  ~AsdRegion ();
+
+  /**
+   * \brief Deletes region tile set, detector and map once extraction is done.
+   */
+  void release ();
+
+  /**
+   * \brief Returns the first owned tile column.
+   */
+  inline int firstColumn () const { return col_min; }
+
+  /**
+   * \brief Returns the last owned tile column + 1.
+   */
+  inline int lastColumn () const { return col_max; }
+
+  /**
+   * \brief Checks if a tile column is owned by the region.
+   * @param col Tile column.
+   */
+  inline bool owns (int col) const { return (col >= col_min && col < col_max); }
+
+  /**
+   * \brief Returns the region tile set.
+   */
+  inline IPtTileSet *tileSet () const { return ptset; }
+
+  /**
+   * \brief Returns the region road detector.
+   */
+  inline CTrackDetector *detector () const { return ctdet; }
+
+  /**
+   * \brief Returns the region partial detection map.
+   */
+  inline AmrelMap *map () const { return detection_map; }
+
+  /**
+   * \brief Records a detected road section.
+   * @param k Tile of the section seed.
+   * @param p1 Seed first end.
+   * @param p2 Seed second end.
+   * @param spans Road pixel runs, moved into the region.
+   * @param ct Detected carriage track to keep (or NULL).
+   */
+  void addSection (int k, const Pt2i &p1, const Pt2i &p2,
+                   CTrackSpans &spans, CarriageTrack *ct);
+
+  /**
+   * \brief Returns the count of recorded road sections.
+   */
+  inline int countOfSections () const { return ((int) (tiles.size ())); }
+
+  /**
+   * \brief Returns the tile of a road section seed.
+   * @param i Road section index.
+   */
+  inline int sectionTile (int i) const { return tiles[i]; }
+
+  /**
+   * \brief Returns the first end of a road section seed.
+   * @param i Road section index.
+   */
+  inline const Pt2i &sectionStart (int i) const { return seeds[2 * i]; }
+
+  /**
+   * \brief Returns the second end of a road section seed.
+   * @param i Road section index.
+   */
+  inline const Pt2i &sectionEnd (int i) const { return seeds[2 * i + 1]; }
+
+  /**
+   * \brief Returns the pixel runs of a road section.
+   * @param i Road section index.
+   */
+  inline const CTrackSpans &sectionSpans (int i) const { return spans[i]; }
+
+  /**
+   * \brief Returns the carriage track of a road section and releases it.
+   * @param i Road section index.
+   */
+  CarriageTrack *takeSection (int i);
+
+  /**
+   * \brief Records a seed suppressed by a road section of the region.
+   * The suppressing section is the one found at the seed center in the
+   *   region map, so that the seed can be retried if that section is
+   *   dropped at merge.
+   * @param k Tile of the seed.
+   * @param p1 Seed first end.
+   * @param p2 Seed second end.
+   */
+  void addSuppressedSeed (int k, const Pt2i &p1, const Pt2i &p2);
+
+  /**
+   * \brief Returns the count of recorded suppressed seeds.
+   */
+  inline int countOfSuppressedSeeds () const {
+    return ((int) (sup_tiles.size ())); }
+
+  /**
+   * \brief Returns the tile of a suppressed seed.
+   * @param i Suppressed seed index.
+   */
+  inline int suppressedTile (int i) const { return sup_tiles[i]; }
+
+  /**
+   * \brief Returns the first end of a suppressed seed.
+   * @param i Suppressed seed index.
+   */
+  inline const Pt2i &suppressedStart (int i) const { return sup_seeds[2 * i]; }
+
+  /**
+   * \brief Returns the second end of a suppressed seed.
+   * @param i Suppressed seed index.
+   */
+  inline const Pt2i &suppressedEnd (int i) const {
+    return sup_seeds[2 * i + 1]; }
+
+  /**
+   * \brief Returns the road section that suppressed a seed (-1 if unknown).
+   * @param i Suppressed seed index.
+   */
+  inline int suppressingSection (int i) const { return sup_sections[i]; }
+
+
+private:
+
+  /** First owned tile column. */
+  int col_min;
+  /** Last owned tile column + 1. */
+  int col_max;
+  /** Tile set of owned and halo tiles. */
+  IPtTileSet *ptset;
+  /** Road detector. */
+  CTrackDetector *ctdet;
+  /** Partial detection map. */
+  AmrelMap *detection_map;
+
+  /** Seed tiles of detected road sections. */
+  std::vector<int> tiles;
+  /** Seeds of detected road sections (pairs of stroke ends). */
+  std::vector<Pt2i> seeds;
+  /** Pixel runs of detected road sections. */
+  std::vector<CTrackSpans> spans;
+  /** Kept carriage tracks of detected road sections. */
+  std::vector<CarriageTrack *> tracks;
+
+  /** Tiles of suppressed seeds. */
+  std::vector<int> sup_tiles;
+  /** Suppressed seeds (pairs of stroke ends). */
+  std::vector<Pt2i> sup_seeds;
+  /** Road sections that suppressed the seeds. */
+  std::vector<int> sup_sections;
+};
+#endif
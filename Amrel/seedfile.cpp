@@ -0,0 +1,288 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <cstring>
+#include <fstream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "seedfile.h"
+
+
+const char SeedFile::TAG[4] = { 'S', 'E', 'E', 'D' };
+const int SeedFile::VERSION = 1;
+const int SeedFile::HEADER_SIZE = 32;
+const int SeedFile::ENTRY_SIZE = 16;
+const int SeedFile::LEGACY_HEADER_SIZE = 24;
+
+
+
+bool SeedFile::save (const std::string &name, int width, int height,
+                     float csize, int cols, int rows,
+                     const std::vector<Pt2i> *seeds)
+{
+  std::ofstream out (name.c_str (), std::ios::out | std::ios::binary);
+  if (! out.is_open ()) return false;
+  int nbt = cols * rows;
+  int nb = 0;
+  for (int k = 0; k < nbt; k++) nb += (int) (seeds[k].size ());
+  int fcs;
+  memcpy (&fcs, &csize, sizeof (float));
+
+  // Header and table are built as integers (tag apart), then stored
+  std::vector<int> head (HEADER_SIZE / 4 + nbt * ENTRY_SIZE / 4, 0);
+  head[1] = VERSION;
+  head[2] = width;
+  head[3] = height;
+  head[4] = fcs;
+  head[5] = cols;
+  head[6] = rows;
+  head[7] = nb;
+  long long pos = HEADER_SIZE + (long long) nbt * ENTRY_SIZE;
+  for (int k = 0; k < nbt; k++)
+  {
+    int *entry = &head[HEADER_SIZE / 4 + k * ENTRY_SIZE / 4];
+    entry[0] = (int) (pos & 0xffffffffLL);
+    entry[1] = (int) (pos >> 32);
+    entry[2] = (int) (seeds[k].size ());
+    pos += seeds[k].size () * 8;
+  }
+  std::vector<unsigned char> buf (TAG, TAG + 4);
+  buf.reserve (head.size () * 4);
+  for (int i = 1; i < (int) (head.size ()); i++)
+  {
+    unsigned int v = (unsigned int) head[i];
+    for (int b = 0; b < 4; b++) buf.push_back ((unsigned char) (v >> (8 * b)));
+  }
+  out.write ((const char *) buf.data (), buf.size ());
+
+  // Seeds
+  for (int k = 0; k < nbt; k++)
+  {
+    buf.clear ();
+    std::vector<Pt2i>::const_iterator it = seeds[k].begin ();
+    while (it != seeds[k].end ())
+    {
+      unsigned int x = (unsigned int) it->x (), y = (unsigned int) it->y ();
+      for (int b = 0; b < 4; b++) buf.push_back ((unsigned char) (x >> (8 * b)));
+      for (int b = 0; b < 4; b++) buf.push_back ((unsigned char) (y >> (8 * b)));
+      it ++;
+    }
+    out.write ((const char *) buf.data (), buf.size ());
+  }
+  bool ok = out.good ();
+  out.close ();
+  return ok;
+}
+
+
+SeedFile::SeedFile ()
+{
+  data = NULL;
+  data_size = 0;
+  mapped = false;
+  header = NULL;
+  table = NULL;
+}
+
+
+SeedFile::~SeedFile ()
+{
+  close ();
+}
+
+
+bool SeedFile::open (const std::string &name)
+{
+  close ();
+  // Stored values are read in place : little-endian hosts only
+  const int one = 1;
+  if (*((const char *) &one) != 1) return false;
+  if (! mapFile (name)) return false;
+  if (memcmp (data, TAG, 4) != 0) return (convertLegacy ());
+  if (data_size < (size_t) HEADER_SIZE || header[1] != VERSION
+      || (size_t) HEADER_SIZE + (size_t) (header[5] * header[6]) * ENTRY_SIZE
+         > data_size)
+  {
+    close ();
+    return false;
+  }
+  for (int k = 0; k < header[5] * header[6]; k++)
+    if ((size_t) (((long long) (unsigned int) table[4 * k])
+                  | (((long long) table[4 * k + 1]) << 32))
+        + (size_t) tileSize (k) * 8 > data_size)
+    {
+      close ();
+      return false;
+    }
+  return true;
+}
+
+
+void SeedFile::close ()
+{
+#ifndef _WIN32
+  if (mapped) munmap ((void *) data, data_size);
+#endif
+  store.clear ();
+  data = NULL;
+  data_size = 0;
+  mapped = false;
+  header = NULL;
+  table = NULL;
+}
+
+
+bool SeedFile::mapFile (const std::string &name)
+{
+#ifdef _WIN32
+  // No mapping : the whole file is read
+  std::ifstream in (name.c_str (), std::ios::in | std::ios::binary);
+  if (! in.is_open ()) return false;
+  in.seekg (0, std::ios::end);
+  long long fsize = (long long) in.tellg ();
+  if (fsize < LEGACY_HEADER_SIZE) return false;
+  in.seekg (0, std::ios::beg);
+  store.resize ((size_t) ((fsize + 3) / 4));
+  in.read ((char *) store.data (), fsize);
+  if (! in)
+  {
+    store.clear ();
+    return false;
+  }
+  data = (const char *) store.data ();
+  data_size = (size_t) fsize;
+#else
+  int fd = ::open (name.c_str (), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat st;
+  if (fstat (fd, &st) != 0 || st.st_size < LEGACY_HEADER_SIZE)
+  {
+    ::close (fd);
+    return false;
+  }
+  void *map = mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close (fd);
+  if (map == MAP_FAILED) return false;
+  data = (const char *) map;
+  data_size = (size_t) st.st_size;
+  mapped = true;
+#endif
+  header = (const int *) data;
+  table = header + HEADER_SIZE / 4;
+  return true;
+}
+
+
+bool SeedFile::convertLegacy ()
+{
+  // Former format : map width and height, cell size, count of tile columns
+  //   and rows, count of seed points, then all the points (two integers).
+  const int *old = (const int *) data;
+  int w = old[0], h = old[1], cols = old[3], rows = old[4], nb = old[5];
+  if (w <= 0 || h <= 0 || cols <= 0 || rows <= 0 || nb < 0 || nb % 2 != 0
+      || (size_t) LEGACY_HEADER_SIZE + (size_t) nb * 8 != data_size)
+  {
+    close ();
+    return false;
+  }
+
+  // Seeds are sorted by tile of their centre, keeping their order
+  int nbt = cols * rows;
+  int tw = w / cols, th = h / rows;
+  const int *pts = old + LEGACY_HEADER_SIZE / 4;
+  std::vector<int> tiles (nb / 2), counts (nbt, 0);
+  for (int i = 0; i < nb / 2; i++, pts += 4)
+  {
+    int tilex = ((pts[0] + pts[2]) / 2) / tw;
+    if (tilex < 0) tilex = 0;
+    else if (tilex >= cols) tilex = cols - 1;
+    int tiley = ((pts[1] + pts[3]) / 2) / th;
+    if (tiley < 0) tiley = 0;
+    else if (tiley >= rows) tiley = rows - 1;
+    tiles[i] = tiley * cols + tilex;
+    counts[tiles[i]] += 2;
+  }
+  int tabsize = HEADER_SIZE / 4 + nbt * ENTRY_SIZE / 4;
+  std::vector<int> conv (tabsize + 2 * (size_t) nb, 0);
+  memcpy (conv.data (), TAG, 4);
+  conv[1] = VERSION;
+  conv[2] = w;
+  conv[3] = h;
+  conv[4] = old[2];
+  conv[5] = cols;
+  conv[6] = rows;
+  conv[7] = nb;
+  std::vector<int> pos (nbt);
+  long long off = tabsize;
+  for (int k = 0; k < nbt; k++)
+  {
+    int *entry = &conv[HEADER_SIZE / 4 + k * ENTRY_SIZE / 4];
+    entry[0] = (int) ((off * 4) & 0xffffffffLL);
+    entry[1] = (int) ((off * 4) >> 32);
+    entry[2] = counts[k];
+    pos[k] = (int) off;
+    off += 2 * counts[k];
+  }
+  pts = old + LEGACY_HEADER_SIZE / 4;
+  for (int i = 0; i < nb / 2; i++, pts += 4)
+  {
+    memcpy (&conv[pos[tiles[i]]], pts, 16);
+    pos[tiles[i]] += 4;
+  }
+
+  // The converted file replaces the former one
+  close ();
+  store.swap (conv);
+  data = (const char *) store.data ();
+  data_size = store.size () * 4;
+  header = store.data ();
+  table = header + HEADER_SIZE / 4;
+  return true;
+}
+
+
+float SeedFile::cellSize () const
+{
+  float cs;
+  memcpy (&cs, header + 4, sizeof (float));
+  return cs;
+}
+
+
+const int *SeedFile::tileSeeds (int k) const
+{
+  long long pos = ((long long) (unsigned int) table[4 * k])
+                  | (((long long) table[4 * k + 1]) << 32);
+  return ((const int *) (data + pos));
+}
+
+
+void SeedFile::getTileSeeds (int k, std::vector<Pt2i> &seeds) const
+{
+  const int *pt = tileSeeds (k);
+  int nb = tileSize (k);
+  seeds.reserve (seeds.size () + nb);
+  for (int i = 0; i < nb; i++, pt += 2) seeds.push_back (Pt2i (pt[0], pt[1]));
+}
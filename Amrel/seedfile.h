@@ -0,0 +1,183 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SEED_FILE_H
+#define SEED_FILE_H
+
+#include <string>
+#include <vector>
+#include "pt2i.h"
+
+
+/** 
+ * @class SeedFile seedfile.h
+ * \brief Indexed file of road seeds, sorted by tile.
+ * The file starts with a 32 bytes header : a 4 chars tag, the format
+ *   version, the map width and height, the cell size, the count of tile
+ *   columns and rows, and the total count of seed points.
+ * A table follows, with for each tile (row by row) the byte offset of its
+ *   seeds in the file, their count of points, and a spare integer.
+ * Seeds are stored as pairs of points, each point by its two coordinates.
+ * All the values are little-endian 32 bits integers, except the 64 bits
+ *   tile offsets, so that the file can be memory mapped.
+ * The file is mapped on opening, so that only the pages of the accessed
+ *   tiles are effectively read (on Windows, it is fully read instead).
+ * Files of the former format (a flat list of seed points) are still
+ *   accepted, and sorted by tile in memory on opening.
+ */
+class SeedFile
+{
+public:
+
+  /**
+   * \brief Saves seeds in an indexed seed file.
+   * Returns whether the file was successfully written.
+   * @param name File name.
+   * @param width Map width.
+   * @param height Map height.
+   * @param csize Map cell size.
+   * @param cols Count of tile columns.
+   * @param rows Count of tile rows.
+   * @param seeds Array of seeds vectors, one per tile.
+   */
+  static bool save (const std::string &name, int width, int height,
+                    float csize, int cols, int rows,
+                    const std::vector<Pt2i> *seeds);
+
+  /**
+   * \brief Creates a closed seed file.
+   */
+  SeedFile ();
+
+  /**
+   * \brief Closes and deletes the seed file.
+   */
+  ~SeedFile ();
+
+  /**
+   * \brief Maps a seed file in memory.
+   * Returns whether the file could be mapped with a known format.
+   * @param name File name.
+   */
+  bool open (const std::string &name);
+
+  /**
+   * \brief Unmaps the seed file.
+   */
+  void close ();
+
+  /**
+   * \brief Returns whether the seed file is open.
+   */
+  inline bool isOpen () const { return (data != NULL); }
+
+  /**
+   * \brief Returns the map width.
+   */
+  inline int width () const { return (header[2]); }
+
+  /**
+   * \brief Returns the map height.
+   */
+  inline int height () const { return (header[3]); }
+
+  /**
+   * \brief Returns the map cell size.
+   */
+  float cellSize () const;
+
+  /**
+   * \brief Returns the count of tile columns.
+   */
+  inline int columnsOfTiles () const { return (header[5]); }
+
+  /**
+   * \brief Returns the count of tile rows.
+   */
+  inline int rowsOfTiles () const { return (header[6]); }
+
+  /**
+   * \brief Returns the total count of seed points.
+   */
+  inline int size () const { return (header[7]); }
+
+  /**
+   * \brief Returns the count of seed points of a tile.
+   * @param k Tile index.
+   */
+  inline int tileSize (int k) const { return (table[4 * k + 2]); }
+
+  /**
+   * \brief Returns the seeds of a tile as interleaved point coordinates.
+   * @param k Tile index.
+   */
+  const int *tileSeeds (int k) const;
+
+  /**
+   * \brief Appends the seeds of a tile to a vector.
+   * @param k Tile index.
+   * @param seeds Vector to complete.
+   */
+  void getTileSeeds (int k, std::vector<Pt2i> &seeds) const;
+
+
+private:
+
+  /** File format tag. */
+  static const char TAG[4];
+  /** File format version. */
+  static const int VERSION;
+  /** Size of the file header. */
+  static const int HEADER_SIZE;
+  /** Size of a tile entry in the table. */
+  static const int ENTRY_SIZE;
+  /** Size of the header of the former file format. */
+  static const int LEGACY_HEADER_SIZE;
+
+  /** Mapped file. */
+  const char *data;
+  /** Mapped file size. */
+  size_t data_size;
+  /** Mapping status of the file data (read or converted otherwise). */
+  bool mapped;
+  /** Storage of the file data when not mapped. */
+  std::vector<int> store;
+  /** File header. */
+  const int *header;
+  /** Table of tiles. */
+  const int *table;
+
+  /**
+   * \brief Maps a file in memory, or reads it where mapping is not available.
+   * Returns whether the file could be accessed.
+   * @param name File name.
+   */
+  bool mapFile (const std::string &name);
+
+  /**
+   * \brief Converts a mapped file of the former format.
+   * The file is unmapped and replaced by its conversion in memory.
+   * Returns whether the file had a consistent former format.
+   */
+  bool convertLegacy ();
+};
+
+#endif
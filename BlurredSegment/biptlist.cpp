@@ -22,9 +22,15 @@
 #include "biptlist.h"
 
 
+const int BiPtList::INITIAL_CAPACITY = 64;
+
+
 BiPtList::BiPtList (Pt2i pt)
 {
-  pts.push_back (pt);
+  capacity = INITIAL_CAPACITY;
+  pts = new Pt2i[capacity];
+  first = capacity / 2;
+  pts[first].set (pt);
   start = 0;
   cpt = 1;
 }
@@ -32,12 +38,27 @@ BiPtList::BiPtList (Pt2i pt)
 
 BiPtList::~BiPtList ()
 {
+  delete [] pts;
+}
+
+
+void BiPtList::grow ()
+{
+  int ncapa = 2 * capacity;
+  int nfirst = (ncapa - cpt) / 2;
+  Pt2i *npts = new Pt2i[ncapa];
+  for (int i = 0; i < cpt; i++) npts[nfirst + i].set (pts[first + i]);
+  delete [] pts;
+  pts = npts;
+  capacity = ncapa;
+  first = nfirst;
 }
 
 
 void BiPtList::addFront (Pt2i pt)
 {
-  pts.push_front (pt);
+  if (first == 0) grow ();
+  pts[--first].set (pt);
   start++;
   cpt++;
 }
@@ -45,7 +66,8 @@ void BiPtList::addFront (Pt2i pt)
 
 void BiPtList::addBack (Pt2i pt)
 {
-  pts.push_back (pt);
+  if (first + cpt == capacity) grow ();
+  pts[first + cpt].set (pt);
   cpt++;
 }
 
@@ -53,7 +75,8 @@ void BiPtList::addBack (Pt2i pt)
 void BiPtList::removeFront (int n)
 {
   if (n >= frontSize ()) n = frontSize () - 1; // We keep at least one point
-  for (int i = 0; i < n; i++) pts.pop_front ();
+  if (n < 0) n = 0;
+  first += n;
   cpt -= n;
   start -= n;
   if (start < 0) start = 0; // Theoretically impossible
@@ -63,7 +86,7 @@ void BiPtList::removeFront (int n)
 void BiPtList::removeBack (int n)
 {
   if (n >= backSize ()) n = backSize () - 1;  // We keep at least one point
-  for (int i = 0; i < n; i++) pts.pop_back ();
+  if (n < 0) n = 0;
   cpt -= n;
   if (start >= cpt) start = cpt - 1;  // Theoretically impossible
 }
@@ -71,12 +94,13 @@ void BiPtList::removeBack (int n)
 
 void BiPtList::findExtrema (int &xmin, int &ymin, int &xmax, int &ymax) const
 {
-  std::deque<Pt2i>::const_iterator it = pts.begin ();
+  const Pt2i *it = pts + first;
+  const Pt2i *end = it + cpt;
   xmin = it->x ();
   ymin = it->y ();
   xmax = it->x ();
   ymax = it->y ();
-  while (it != pts.end ())
+  while (it != end)
   {
     if (xmin > it->x ()) xmin = it->x ();
     if (xmax < it->x ()) xmax = it->x ();
@@ -89,11 +113,7 @@ void BiPtList::findExtrema (int &xmin, int &ymin, int &xmax, int &ymax) const
 
 std::vector<Pt2i> BiPtList::frontToBackPoints () const
 {
-  std::vector<Pt2i> res;
-  for (std::deque<Pt2i>::const_iterator it = pts.begin ();
-       it != pts.end (); it++)
-    res.push_back (*it);
-  return (res);
+  return (std::vector<Pt2i> (pts + first, pts + first + cpt));
 }
 
 
@@ -106,20 +126,13 @@ std::vector<Pt2i> *BiPtList::emptyVector () const
 std::vector<Pt2i> *BiPtList::frontPoints () const
 {
   // Entered from extremity to center : relevant ?
-  std::vector<Pt2i> *res = new std::vector<Pt2i> ();
-  std::deque<Pt2i>::const_iterator it = pts.begin ();
-  for (int i = 0; i < start; i++) res->push_back (*it++);
-  return res;
+  return (new std::vector<Pt2i> (frontSpan (), frontSpan () + start));
 }
 
 
 std::vector<Pt2i> *BiPtList::backPoints () const
 {
-  std::vector<Pt2i> *res = new std::vector<Pt2i> ();
-  std::deque<Pt2i>::const_iterator it = pts.begin ();
-  it += start + 1;
-  for (int i = 0; i < cpt - start - 1; i++) res->push_back (*it++);
-  return res;
+  return (new std::vector<Pt2i> (backSpan (), backSpan () + backSize ()));
 }
 
 
@@ -134,8 +147,8 @@ EDist BiPtList::heightToEnds (const Pt2i &pt) const
 EDist BiPtList::xHeightToEnds (const Pt2i &pt) const
 {
   int xp = pt.x (), yp = pt.y ();
-  int p1x = pts.front().x (), p1y = pts.front().y ();
-  int p2x = pts.back().x (), p2y = pts.back().y ();
+  int p1x = pts[first].x (), p1y = pts[first].y ();
+  int p2x = pts[first + cpt - 1].x (), p2y = pts[first + cpt - 1].y ();
   int ax, ay, bx, by, cx, cy;
 
   if (xp < p1x)
@@ -207,8 +220,8 @@ EDist BiPtList::xHeightToEnds (const Pt2i &pt) const
 EDist BiPtList::yHeightToEnds (const Pt2i &pt) const
 {
   int xp = pt.x (), yp = pt.y ();
-  int p1x = pts.front().x (), p1y = pts.front().y ();
-  int p2x = pts.back().x (), p2y = pts.back().y ();
+  int p1x = pts[first].x (), p1y = pts[first].y ();
+  int p2x = pts[first + cpt - 1].x (), p2y = pts[first + cpt - 1].y ();
   int ax, ay, bx, by, cx, cy;
 
   if (yp < p1y)
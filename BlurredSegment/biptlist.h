@@ -24,12 +24,14 @@
 
 #include "pt2i.h"
 #include "edist.h"
-#include <deque>
+#include <vector>
 
 
 /** 
  * @class BiPtList biptlist.h
  * \brief Bi-directional list of points.
+ * Points are stored front to back in a contiguous buffer, growing from
+ *   its middle on both sides, and reallocated only when a side is full.
  */
 class BiPtList
 {
@@ -64,17 +66,35 @@ public:
   /**
    * \brief Returns the initial point of the bi-directional list.
    */
-  inline Pt2i initialPoint () const { return (pts[start]); }
+  inline Pt2i initialPoint () const { return (pts[first + start]); }
 
   /**
    * \brief Returns the back end point of the bi-directional list.
    */
-  inline Pt2i backPoint () const { return (pts.back ()); }
+  inline Pt2i backPoint () const { return (pts[first + cpt - 1]); }
 
   /**
    * \brief Returns the front end point of the bi-directional list.
    */
-  inline Pt2i frontPoint () const { return (pts.front ()); }
+  inline Pt2i frontPoint () const { return (pts[first]); }
+
+  /**
+   * \brief Returns the contiguous array of front to back points.
+   * The array holds size () points and remains valid until next addition.
+   */
+  inline const Pt2i *points () const { return (pts + first); }
+
+  /**
+   * \brief Returns the contiguous array of front points.
+   * The array holds frontSize () points, from the front end point.
+   */
+  inline const Pt2i *frontSpan () const { return (pts + first); }
+
+  /**
+   * \brief Returns the contiguous array of back points.
+   * The array holds backSize () points, from the initial point excluded.
+   */
+  inline const Pt2i *backSpan () const { return (pts + first + start + 1); }
 
   /**
    * \brief Returns a point Manhattan height to the line between end points.
@@ -141,13 +161,25 @@ public:
 
 private:
 
-  /** List of points. */
-  std::deque<Pt2i> pts;
-  /** Index of the initial point. */
+  /** Initial capacity of the point buffer. */
+  static const int INITIAL_CAPACITY;
+
+  /** Point buffer. */
+  Pt2i *pts;
+  /** Size of the point buffer. */
+  int capacity;
+  /** Index of the front end point in the buffer. */
+  int first;
+  /** Index of the initial point from the front end point. */
   int start;
   /** Length of the point list. */
   int cpt;
 
+  /**
+   * \brief Reallocates the point buffer with free room on both sides.
+   */
+  void grow ();
+
 
   /**
    * \brief Returns a point X-height to the line between list end points.
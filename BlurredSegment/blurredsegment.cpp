@@ -179,14 +179,15 @@ Vr2i BlurredSegment::boundingBoxSize () const
 std::vector <std::vector <Pt2i> > BlurredSegment::connectedComponents () const
 {
   std::vector <std::vector <Pt2i> > ccs;
-  std::vector <Pt2i> pts = getAllPoints ();
-  if (pts.size () > 1)
+  const Pt2i *pts = plist->points ();
+  const Pt2i *pend = pts + plist->size ();
+  if (plist->size () > 1)
   {
     std::vector <Pt2i> cc;
     bool started = false;
-    std::vector <Pt2i>::const_iterator it = pts.begin ();
+    const Pt2i *it = pts;
     Pt2i pix (*it++);
-    while (it != pts.end ())
+    while (it != pend)
     {
       if (it->isConnectedTo (pix))
       {
@@ -216,13 +217,14 @@ std::vector <std::vector <Pt2i> > BlurredSegment::connectedComponents () const
 int BlurredSegment::countOfConnectedPoints () const
 {
   int count = 0;
-  std::vector <Pt2i> pts = getAllPoints ();
-  if (pts.size () > 1)
+  const Pt2i *pts = plist->points ();
+  const Pt2i *pend = pts + plist->size ();
+  if (plist->size () > 1)
   {
     bool started = false;
-    std::vector <Pt2i>::const_iterator it = pts.begin ();
+    const Pt2i *it = pts;
     Pt2i pix (*it++);
-    while (it != pts.end ())
+    while (it != pend)
     {
       if (it->isConnectedTo (pix))
       {
@@ -247,13 +249,14 @@ int BlurredSegment::countOfConnectedPoints () const
 int BlurredSegment::countOfConnectedComponents () const
 {
   int count = 0;
-  std::vector <Pt2i> pts = getAllPoints ();
-  if (pts.size () > 1)
+  const Pt2i *pts = plist->points ();
+  const Pt2i *pend = pts + plist->size ();
+  if (plist->size () > 1)
   {
     bool started = false;
-    std::vector <Pt2i>::const_iterator it = pts.begin ();
+    const Pt2i *it = pts;
     Pt2i pix (*it++);
-    while (it != pts.end ())
+    while (it != pend)
     {
       if (it->isConnectedTo (pix))
       {
@@ -277,13 +280,14 @@ int BlurredSegment::countOfConnectedComponents () const
 int BlurredSegment::countOfConnectedPoints (int min) const
 {
   int count = 0;
-  std::vector <Pt2i> pts = getAllPoints ();
-  if (pts.size () > 1)
+  const Pt2i *pts = plist->points ();
+  const Pt2i *pend = pts + plist->size ();
+  if (plist->size () > 1)
   {
     int cpt = 1;
-    std::vector <Pt2i>::const_iterator it = pts.begin ();
+    const Pt2i *it = pts;
     Pt2i pix (*it++);
-    while (it != pts.end ())
+    while (it != pend)
     {
       if (it->isConnectedTo (pix))
       {
@@ -301,13 +305,14 @@ int BlurredSegment::countOfConnectedPoints (int min) const
 int BlurredSegment::countOfConnectedComponents (int min) const
 {
   int count = 0;
-  std::vector <Pt2i> pts = getAllPoints ();
-  if (pts.size () > 1)
+  const Pt2i *pts = plist->points ();
+  const Pt2i *pend = pts + plist->size ();
+  if (plist->size () > 1)
   {
     int cpt = 1;
-    std::vector <Pt2i>::const_iterator it = pts.begin ();
+    const Pt2i *it = pts;
     Pt2i pix (*it++);
-    while (it != pts.end ())
+    while (it != pend)
     {
       if (it->isConnectedTo (pix))
       {
@@ -325,11 +330,12 @@ std::vector <std::vector <Pt2i> >
 BlurredSegment::getConnectedComponents () const
 {
   std::vector <std::vector <Pt2i> > res;
-  std::vector <Pt2i> pts = getAllPoints ();
-  if (pts.size () > 1)
+  const Pt2i *pts = plist->points ();
+  const Pt2i *pend = pts + plist->size ();
+  if (plist->size () > 1)
   {
-    std::vector <Pt2i>::const_iterator bit = pts.begin ();
-    std::vector <Pt2i>::const_iterator eit = pts.end ();
+    const Pt2i *bit = pts;
+    const Pt2i *eit = pend;
     while (bit != eit)
     {
       std::vector <Pt2i> lres;
@@ -135,6 +135,13 @@ public:
    */
   std::vector<Pt2i> getAllPoints () const;
 
+  /**
+   * \brief Returns the contiguous array of all the blurred segment points.
+   * Points are ordered from the left end point up to the right end point.
+   * The array holds size () points and should not be modified.
+   */
+  inline const Pt2i *getPoints () const { return plist->points (); }
+
   /**
    * \brief Returns the set of points on the left part of the blurred segment.
    * Points are ordered from the furthest to the nearest to the start point.
@@ -91,6 +91,10 @@ BSDetector::BSDetector ()
   bsini = NULL;
   bsf = NULL;
   resultValue = RESULT_UNDETERMINED;
+
+  locmax = NULL;
+  nbstrokes = 0;
+  nballocs = 0;
 }
 
 
@@ -104,6 +108,7 @@ BSDetector::~BSDetector ()
   if (bsf != NULL) delete bsf;
   std::vector <BlurredSegment *>::iterator it = mbsf.begin ();
   while (it != mbsf.end ()) delete (*it++);
+  if (locmax != NULL) delete [] locmax;
 }
 
 
@@ -134,6 +139,13 @@ void BSDetector::setGradientMap (VMap *data)
   if (bst1) bst1->setGradientMap (data);
   if (bst2) bst2->setGradientMap (data);
   if (nfaOn) nfaf->init (data);
+
+  // Sizes the multi-detection buffers once for all the strokes
+  if (locmax != NULL) delete [] locmax;
+  locmax = new int[data->getHeightWidthMax ()];
+  stroke.clear ();
+  stroke.reserve (data->getHeightWidthMax ());
+  nballocs += 2;
 }
 
 
@@ -148,6 +160,7 @@ void BSDetector::detectAll ()
   // Runs the automatic detection sweep algorithm
   bool isnext = true;
   nbtrials = 0;
+  nbstrokes = 0;
   int width = gMap->getWidth ();
   int height = gMap->getHeight ();
   for (int x = width / 2; isnext && x > 0; x -= autoSweepingStep)
@@ -181,6 +194,7 @@ void BSDetector::detectAllWithBalancedXY ()
   // Runs the automatic detection balanced sweep algorithm
   bool isnext = true;
   nbtrials = 0;
+  nbstrokes = 0;
   int width = gMap->getWidth ();
   int height = gMap->getHeight ();
   int xg = width / 2, yb = height / 2;
@@ -233,6 +247,7 @@ void BSDetector::detectSelection (const Pt2i &p1, const Pt2i &p2)
     gMap->setMasking (true);
     gMap->clearMask ();
     nbtrials = 0;
+    nbstrokes = 0;
     detectMulti (p1, p2);
 
     // Updates the selected segment for survey
@@ -264,16 +279,16 @@ void BSDetector::freeMultiSelection ()
 bool BSDetector::detectMulti (const Pt2i &p1, const Pt2i &p2)
 {
   // Finds and sorts local max of gradient magnitude along the input stroke
-  std::vector<Pt2i> pts;
-  p1.draw (pts, p2);
-  int *locmax = new int[pts.size ()];
-  int nlm = gMap->localMax (locmax, pts);
+  stroke.clear ();
+  p1.draw (stroke, p2);
+  int nlm = gMap->localMax (locmax, stroke);
+  nbstrokes ++;
 
   // Detects a blurred segment for each local max
   bool isnext = true;
   for (int i = 0; isnext && i < nlm; i++)
   {
-    Pt2i ptstart = pts.at (locmax[i]);
+    Pt2i ptstart = stroke.at (locmax[i]);
     if (gMap->isFree (ptstart))
     {
       // Handles opposite edge orientations
@@ -286,7 +301,7 @@ bool BSDetector::detectMulti (const Pt2i &p1, const Pt2i &p2)
         // Detects a blurred segment
         if (detectSingle (p1, p2, true, ptstart) == RESULT_OK)
         {
-          gMap->setMask (bsf->getAllPoints ());
+          gMap->setMask (bsf->getPoints (), bsf->size ());
           mbsf.push_back (bsf);
           bsf = NULL; // to avoid BS deletion
 
@@ -406,7 +421,7 @@ int BSDetector::detectSingle (const Pt2i &p1, const Pt2i &p2,
   if (finalSizeTestOn)
   {
     // DigitalStraightSegment *dss = bsf->getSegment ();
-    if ((int) (bsf->getAllPoints().size ()) < finalMinSize)
+    if (bsf->size () < finalMinSize)
       return RESULT_FINAL_TOO_SMALL;
   }
 
@@ -444,8 +459,9 @@ int BSDetector::getDigitalStraightSegments (
     return (1);
   }
   int nb = 0;
-  std::vector<BlurredSegment *>::const_iterator it = mbsf.begin ();
-  while (it != mbsf.end ())
+  const std::vector<BlurredSegment *> &segs = (nfaOn ? vbsf : mbsf);
+  std::vector<BlurredSegment *>::const_iterator it = segs.begin ();
+  while (it != segs.end ())
   {
     BlurredSegment *bs = (*it++);
     if (bs != NULL)
@@ -474,8 +490,9 @@ int BSDetector::copyDigitalStraightSegments (
     return 1;
   }
   int nb = 0;
-  std::vector<BlurredSegment *>::const_iterator it = mbsf.begin ();
-  while (it != mbsf.end ())
+  const std::vector<BlurredSegment *> &segs = (nfaOn ? vbsf : mbsf);
+  std::vector<BlurredSegment *>::const_iterator it = segs.begin ();
+  while (it != segs.end ())
   {
     BlurredSegment *bs = (*it++);
     if (bs != NULL)
@@ -550,10 +567,10 @@ void BSDetector::setFinalScansRecord (bool status)
 void BSDetector::switchNFA ()
 {
   nfaOn = ! nfaOn;
-  if (nfaOn && nfaf == NULL)
+  if (nfaOn)
   {
-    nfaf = new NFAFilter ();
-    nfaf->init (gMap);
+    if (nfaf == NULL) nfaf = new NFAFilter ();
+    if (gMap != NULL) nfaf->init (gMap);
   }
 }
 
@@ -181,6 +181,7 @@ public:
 
   /**
    * \brief Adds digital straight segments to provided list.
+   * Only NFA-validated segments are provided when the NFA filter is on.
    * @param dss List of digital straight segments to be completed.
    */
   int getDigitalStraightSegments (
@@ -188,6 +189,7 @@ public:
 
   /**
    * \brief Adds a copy of the digital straight segments to provided list.
+   * Only NFA-validated segments are provided when the NFA filter is on.
    * @param dss List of digital straight segments to be completed.
    */
   int copyDigitalStraightSegments (
@@ -499,6 +501,18 @@ public:
    */
   inline void resetMaxDetections () { maxtrials = 0; }
 
+  /**
+   * \brief Returns the count of strokes processed by the last multi-detection.
+   */
+  inline int countOfStrokes () const { return (nbstrokes); }
+
+  /**
+   * \brief Returns the count of scratch buffer allocations.
+   * Scratch buffers are sized once for each gradient map, so that this
+   *   count does not depend on the number of processed strokes.
+   */
+  inline int countOfScratchAllocations () const { return (nballocs); }
+
   /**
    * \brief Gets the last detection inputs.
    * @param step Detection step.
@@ -626,6 +640,15 @@ private :
   /** Maximum number of trials in a multi-detection (for survey). */
   int maxtrials;    // DVPT
 
+  /** Multi-detection stroke pixels (reused buffer). */
+  std::vector<Pt2i> stroke;
+  /** Local max index array for multi-detection strokes (reused buffer). */
+  int *locmax;
+  /** Count of strokes processed in the last multi-detection. */
+  int nbstrokes;
+  /** Count of scratch buffer allocations (perf survey). */
+  int nballocs;
+
 
   /**
    * \brief Resets the multi-selection list.
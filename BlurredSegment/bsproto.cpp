@@ -79,6 +79,21 @@ BSProto::~BSProto ()
 }
 
 
+void BSProto::reset (int maxWidth, Pt2i pix)
+{
+  this->maxWidth.set (maxWidth);
+  if (plist != NULL) delete plist;
+  plist = new BiPtList (pix);
+  if (convexhull != NULL) delete convexhull;
+  convexhull = NULL;
+  leftOK = false;
+  rightOK = false;
+  bsFlat = false;
+  bsOK = false;
+  chChanged = false;
+}
+
+
 EDist BSProto::strictThickness () const
 {
   return (convexhull != NULL ? convexhull->thickness () : EDist (0, 1));
@@ -316,6 +331,7 @@ BlurredSegment *BSProto::endOfBirth ()
     Pt2i rlast = plist->backPoint ();
     if (llast.equals (rlast)) // Strange, should not be flat, rightok or leftok
     {
+      delete plist;
       plist = NULL;
       return (NULL);
     }
@@ -334,7 +350,11 @@ BlurredSegment *BSProto::endOfBirth ()
   else return (NULL);
   Pt2i aps (-1, -1), ape (-1, -1), apv (-1, -1);
   if (convexhull != NULL)
+  {
     convexhull->antipodalEdgeAndVertex (aps, ape, apv);
+    delete convexhull;  // Vertices back to the pool
+    convexhull = NULL;
+  }
   BlurredSegment *bbs = new BlurredSegment (plist, seg, aps, ape, apv);
   plist = NULL;  // NECESSARY TO AVOID CONTENTS CLEARANCE !!!
   return (bbs);
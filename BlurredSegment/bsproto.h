@@ -58,6 +58,14 @@ public:
    */
   ~BSProto ();
 
+  /**
+   * \brief Restarts the blurred segment prototype from a new central point.
+   * Allows to reuse the prototype for successive detection trials.
+   * @param maxWidth Maximal width of the blurred segment to build
+   * @param pix Central point of the blurred segment to build
+   */
+  void reset (int maxWidth, Pt2i pix);
+
   /**
    * \brief Checks if the blurred segment has at least two points.
    */
@@ -148,7 +156,8 @@ public:
 
   /**
    * \brief Returns a static blurred segment.
-   * The returned blurred segment can not be extended anymore.
+   * The returned blurred segment can not be extended anymore,
+   *   and convex hull vertices are given back to the thread pool.
    * Returns NULL if the segment is inconsistent (less than 2 points).
    */
   BlurredSegment *endOfBirth ();
@@ -20,7 +20,6 @@
 */
 
 #include "bstracker.h"
-#include "bsproto.h"
 #include <cstddef>
 
 
@@ -51,12 +50,14 @@ BSTracker::BSTracker ()
 
   gMap = NULL;
   cand = new int[1]; // to avoid systematic tests
+  proto = new BSProto (0, Pt2i ());
 }
 
 
 BSTracker::~BSTracker ()
 {
   delete cand;
+  delete proto;
 }
 
 
@@ -82,22 +83,17 @@ BlurredSegment *BSTracker::fastTrack (const Pt2i &p1, const Pt2i &p2,
                                       int swidth, const Pt2i &pc)
 {
   // Creates a static directional scanner
-  DirectionalScanner *ds = NULL;
+  StripScanner ds;
   if (swidth != 0)
   {
     if (swidth < MIN_SCAN) swidth = MIN_SCAN;
-    ds = scanp.getScanner (pc, p1.vectorTo (p2), swidth, false);
+    scanp.setScanner (ds, pc, p1.vectorTo (p2), swidth, false);
   }
-  else ds = scanp.getScanner (p1, p2);
-  if (ds == NULL) return NULL;
+  else scanp.setScanner (ds, p1, p2);
 
   // Gets a first scan
   std::vector<Pt2i> pix;
-  if (ds->first (pix) < MIN_SCAN)
-  {
-    delete ds;
-    return NULL;
-  }
+  if (ds.first (pix) < MIN_SCAN) return NULL;
   if (recordScans)
   {
     scanBound1.push_back (pix.front ());
@@ -112,14 +108,11 @@ BlurredSegment *BSTracker::fastTrack (const Pt2i &p1, const Pt2i &p2,
   else
   {
     candide = gMap->largestIn (pix);
-    if (candide == -1)
-    {
-      delete ds;
-      return NULL;
-    }
+    if (candide == -1) return NULL;
     pfirst.set (pix.at (candide));
   }
-  BSProto bsp (bsMaxWidth, pfirst);
+  BSProto &bsp = *proto;
+  bsp.reset (bsMaxWidth, pfirst);
   Pt2i lastLeft (pfirst);
   Pt2i lastRight (pfirst);
   
@@ -137,7 +130,7 @@ BlurredSegment *BSTracker::fastTrack (const Pt2i &p1, const Pt2i &p2,
     if (scanningRight)
     {
       // Gets next scan
-      if (ds->nextOnRight (pix) < MIN_SCAN) scanningRight = false;
+      if (ds.nextOnRight (pix) < MIN_SCAN) scanningRight = false;
       else
       {
         if (recordScans)
@@ -169,7 +162,7 @@ BlurredSegment *BSTracker::fastTrack (const Pt2i &p1, const Pt2i &p2,
     if (scanningLeft)
     {
       // Gets next scan
-      if (ds->nextOnLeft (pix) < MIN_SCAN) scanningLeft = false;
+      if (ds.nextOnLeft (pix) < MIN_SCAN) scanningLeft = false;
       else
       {
         if (recordScans)
@@ -197,7 +190,6 @@ BlurredSegment *BSTracker::fastTrack (const Pt2i &p1, const Pt2i &p2,
       }
     }
   }
-  delete ds;
 
   // Validates (regenerates) and returns the blurred segment
   BlurredSegment *bs = bsp.endOfBirth ();
@@ -226,18 +218,13 @@ BlurredSegment *BSTracker::fineTrack (const Pt2i &center, const Vr2i &scandir,
   fail_status = 0;
 
   // Creates an adaptive directional scanner
-  DirectionalScanner *ds = scanp.getScanner (center, normal, scanwidth, true);
-  if (ds == NULL)
-  {
-    fail_status = FAILURE_NO_START;
-    return NULL;
-  }
+  StripScanner ds;
+  scanp.setScanner (ds, center, normal, scanwidth, true);
 
   // Looks for a central point
   std::vector<Pt2i> pix;
-  if (ds->first (pix) < MIN_SCAN)
+  if (ds.first (pix) < MIN_SCAN)
   {
-    delete ds;
     fail_status = FAILURE_NO_START;
     return NULL;
   }
@@ -252,13 +239,13 @@ BlurredSegment *BSTracker::fineTrack (const Pt2i &center, const Vr2i &scandir,
   int nbc = gMap->localMax (cand, pix, normal);
   if (nbc == 0)
   {
-    delete ds;
     fail_status = FAILURE_NO_START;
     return NULL;
   }
 
   // Initializes a blurred segment with the first candidate
-  BSProto bsp (bsMaxWidth, pix[cand[0]]);
+  BSProto &bsp = *proto;
+  bsp.reset (bsMaxWidth, pix[cand[0]]);
 
   // Handles assigned thickness control
   bool atcOn = true;
@@ -305,14 +292,14 @@ BlurredSegment *BSTracker::fineTrack (const Pt2i &center, const Vr2i &scandir,
       }
       int ppa, ppb, ppc;
       bsp.getLine()->getCentralLine (ppa, ppb, ppc);
-      ds->bindTo (ppa, ppb, ppc);
+      ds.bindTo (ppa, ppb, ppc);
     }
 
     // Extends on right
     if (scanningRight)
     {
       // Gets next scan
-      if (ds->nextOnRight (pix) < MIN_SCAN)
+      if (ds.nextOnRight (pix) < MIN_SCAN)
       {
         fail_status += FAILURE_IMAGE_BOUND_ON_RIGHT;
         scanningRight = false;
@@ -364,7 +351,7 @@ BlurredSegment *BSTracker::fineTrack (const Pt2i &center, const Vr2i &scandir,
     if (scanningLeft)
     {
       // Gets next scan
-      if (ds->nextOnLeft (pix) < MIN_SCAN)
+      if (ds.nextOnLeft (pix) < MIN_SCAN)
       {
         fail_status += FAILURE_IMAGE_BOUND_ON_LEFT;
         scanningLeft = false;
@@ -414,7 +401,6 @@ BlurredSegment *BSTracker::fineTrack (const Pt2i &center, const Vr2i &scandir,
   }
   if (rstart) bsp.removeRight (rstart);
   if (lstart) bsp.removeLeft (lstart);
-  delete ds;
 
   // Validates (regenerates) and returns the blurred segment
   BlurredSegment *bs = bsp.endOfBirth ();
@@ -23,7 +23,7 @@
 #define BLURRED_SEGMENT_TRACKER_H
 
 #include "scannerprovider.h"
-#include "blurredsegment.h"
+#include "bsproto.h"
 #include "vmap.h"
 
 
@@ -191,6 +191,8 @@ private :
   VMap *gMap;
   /** Candidates array for internal use. */
   int *cand;
+  /** Blurred segment prototype reused by successive trials. */
+  BSProto *proto;
   /** Failure cause registration. */
   int fail_status;
 
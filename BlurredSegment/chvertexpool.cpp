@@ -0,0 +1,71 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "chvertexpool.h"
+
+
+const int CHVertexPool::BLOCK_SIZE = 256;
+
+
+CHVertexPool *CHVertexPool::local ()
+{
+  static thread_local CHVertexPool pool;
+  return (&pool);
+}
+
+
+CHVertexPool::CHVertexPool ()
+{
+  cur = 0;
+  pos = 0;
+  users = 0;
+}
+
+
+CHVertexPool::~CHVertexPool ()
+{
+  for (int i = 0; i < (int) (blocks.size ()); ++i) delete [] blocks[i];
+}
+
+
+void CHVertexPool::release ()
+{
+  if (--users == 0)
+  {
+    cur = 0;
+    pos = 0;
+  }
+}
+
+
+CHVertex *CHVertexPool::create (const Pt2i &p)
+{
+  if (blocks.empty ()) blocks.push_back (new CHVertex[BLOCK_SIZE]);
+  else if (pos == BLOCK_SIZE)
+  {
+    if (++cur == (int) (blocks.size ()))
+      blocks.push_back (new CHVertex[BLOCK_SIZE]);
+    pos = 0;
+  }
+  CHVertex *vx = blocks[cur] + pos++;
+  *vx = CHVertex (p);
+  return vx;
+}
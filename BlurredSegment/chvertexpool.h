@@ -0,0 +1,94 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef CHVERTEX_POOL_H
+#define CHVERTEX_POOL_H
+
+#include <vector>
+#include "chvertex.h"
+
+
+/** 
+ * @class CHVertexPool chvertexpool.h
+ * \brief Arena of convex hull vertices, shared by the hulls of a thread.
+ * Vertices are provided from blocks that are never released until the
+ *   pool deletion. The pool is rewound in bulk when the last convex hull
+ *   that used it is deleted, so that vertex blocks are reused by next
+ *   blurred segment prototypes.
+ */
+class CHVertexPool
+{
+public:
+
+  /**
+   * \brief Returns the vertex pool of the calling thread.
+   */
+  static CHVertexPool *local ();
+
+  /**
+   * \brief Creates an empty vertex pool.
+   */
+  CHVertexPool ();
+
+  /**
+   * \brief Deletes the vertex pool and all its vertex blocks.
+   */
+  ~CHVertexPool ();
+
+  /**
+   * \brief Registers a new user (convex hull) of the pool.
+   */
+  inline void attach () { users ++; }
+
+  /**
+   * \brief Unregisters a user of the pool.
+   * All the vertices are released when no more user is registered.
+   */
+  void release ();
+
+  /**
+   * \brief Provides a new unchained vertex at given position.
+   * @param p Position of the vertex.
+   */
+  CHVertex *create (const Pt2i &p);
+
+  /**
+   * \brief Returns the count of allocated vertex blocks.
+   */
+  inline int countOfBlocks () const { return ((int) blocks.size ()); }
+
+
+private:
+
+  /** Count of vertices in each block. */
+  static const int BLOCK_SIZE;
+
+  /** Allocated vertex blocks. */
+  std::vector<CHVertex*> blocks;
+  /** Index of the block in use. */
+  int cur;
+  /** Index of the next free vertex in the block in use. */
+  int pos;
+  /** Count of registered users. */
+  int users;
+};
+
+#endif
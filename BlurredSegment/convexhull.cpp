@@ -4,9 +4,11 @@
 
 ConvexHull::ConvexHull (const Pt2i &lpt, const Pt2i &cpt, const Pt2i &rpt)
 {
-  CHVertex *cvert = new CHVertex (cpt);
-  leftVertex = new CHVertex (lpt);
-  rightVertex = new CHVertex (rpt);
+  pool = CHVertexPool::local ();
+  pool->attach ();
+  CHVertex *cvert = pool->create (cpt);
+  leftVertex = pool->create (lpt);
+  rightVertex = pool->create (rpt);
   lastToLeft = false;
 
   if (lpt.toLeft (cpt, rpt))
@@ -32,10 +34,6 @@ ConvexHull::ConvexHull (const Pt2i &lpt, const Pt2i &cpt, const Pt2i &rpt)
   apv.setVertical ();
   apv.init (leftVertex, cvert, rightVertex);
 
-  gbg.push_back (leftVertex);
-  gbg.push_back (cvert);
-  gbg.push_back (rightVertex);
-
   old_left = leftVertex;
   old_right = rightVertex;
   old_aph_vertex = aph.vertex ();
@@ -49,7 +47,7 @@ ConvexHull::ConvexHull (const Pt2i &lpt, const Pt2i &cpt, const Pt2i &rpt)
 
 ConvexHull::~ConvexHull ()
 {
-  for (int i = 0; i < (int) (gbg.size ()); ++i) delete gbg [i];
+  pool->release ();
 }
 
 
@@ -80,9 +78,8 @@ void ConvexHull::restore ()
 bool ConvexHull::addPoint (const Pt2i &pt, bool toleft)
 {
   if (inHull (pt, toleft)) return false;
-  CHVertex *vx = new CHVertex (pt);
+  CHVertex *vx = pool->create (pt);
   lastToLeft = toleft;
-  gbg.push_back (vx);
   preserve ();
   insert (vx, toleft);
   aph.update (vx);
@@ -93,9 +90,8 @@ bool ConvexHull::addPoint (const Pt2i &pt, bool toleft)
 
 bool ConvexHull::addPointDS (const Pt2i &pt, bool toleft)
 {
-  CHVertex *vx = new CHVertex (pt);
+  CHVertex *vx = pool->create (pt);
   lastToLeft = toleft;
-  gbg.push_back (vx);
   preserve ();
   insertDS (vx, toleft);
   aph.update (vx);
@@ -108,7 +104,6 @@ bool ConvexHull::moveLastPoint (const Pt2i &pos)
 {
   restore ();
   if (inHull (pos, lastToLeft)) return false;
-  gbg.pop_back ();
   preserve ();
   addPoint (pos, lastToLeft);
   return true;
@@ -2,6 +2,7 @@
 #define CONVEXHULL
 
 #include "antipodal.h"
+#include "chvertexpool.h"
 
 
 /** 
@@ -24,7 +25,7 @@ public:
 
   /**
    * \brief Deletes the convex hull.
-   * Removes all registered vertices.
+   * Releases the vertex pool of the thread.
    */
   ~ConvexHull ();
 
@@ -164,8 +165,8 @@ protected:
   /** Registered disconnected point to the right of previous polyline. */
   CHVertex *rdisconnect;
 
-  /** Collection of released vertices for clearance. */
-  std::vector<CHVertex*> gbg;
+  /** Vertex pool of the creating thread. */
+  CHVertexPool *pool;
 
 
 private:
@@ -32,15 +32,17 @@ NFAFilter::NFAFilter ()
   min_section_length = DEFAULT_MIN_SECTION_LENGTH;
   max_grad2 = 0;
   gradient_map = NULL;
-  cum_histo = NULL;
+  log_histo = NULL;
+  histo_size = 0;
   bs_section_count = 0;
+  log_section_count = 0.;
   lratio = DEFAULT_LRATIO;
 }
 
 
 NFAFilter::~NFAFilter ()
 {
-  delete [] cum_histo;
+  if (log_histo != NULL) delete [] log_histo;
 }
 
 
@@ -51,53 +53,45 @@ void NFAFilter::init (VMap *gmap)
   int width = gradient_map->getWidth ();
   int height = gradient_map->getHeight ();
 
-  // Counts the number of non-gradient pixels
-  int m = 0;
+  // Gets gradient histogram in a single pass, extended on new maxima
+  std::vector<int> histo;
   max_grad2 = 0;
   for (int j = 0; j < height; j++)
   {
     for (int i = 0; i < width; i++)
     {
       int gradval = gradient_map->sqNorm (i, j);
-      if (gradval != 0)
-      {
-        m++;
-        if (gradval > max_grad2) max_grad2 = gradval;
-      }
+      int g = (int) (sqrt (gradval));
+      if (gradval > max_grad2) max_grad2 = gradval;
+      if (g >= (int) (histo.size ())) histo.resize (g + 1, 0);
+      histo[g] ++;
     }
   }
 
-  // Rectification 
-  m = (width -2) * (height - 2);
+  // Count of pixels with computed gradient
+  double m = (double) ((width - 2) * (height - 2));
 
-  // Gets gradient histogram
-  int gmax = (int) (sqrt (max_grad2));
-  if (cum_histo != NULL) delete [] cum_histo;
-  cum_histo = new double[gmax + 1];
-  for (int j = 0; j < height; j++)
-    for (int i = 0; i < width; i++)
-      cum_histo[(int) (sqrt (gradient_map->sqNorm (i, j)))] ++;
-
-  // Gets cumulated histogram
-  for (int i = gmax; i > 0; i--)
-    cum_histo[i-1] += cum_histo[i];
-
-  // Normalization
-  for (int i = 0; i <= gmax; i++)
-    cum_histo[i] /= m;
+  // Gets cumulated histogram logarithm
+  if (log_histo != NULL) delete [] log_histo;
+  histo_size = (int) (histo.size ());
+  log_histo = new double[histo_size];
+  int cum = 0;
+  for (int i = histo_size - 1; i >= 0; i--)
+  {
+    cum += histo[i];
+    log_histo[i] = log (cum / m);
+  }
 }
 
 
-double NFAFilter::nfaValue (double proba, int length)
+double NFAFilter::logNfaValue (int gmin, int length) const
 {
   length = (int) (length / lratio); // Magic number : divForTestSeg
-  double nfa = bs_section_count;
-  for (int i = 0; i < length && nfa > NFA_EPSILON; i++) nfa *= proba;
-  return nfa;
+  return (log_section_count + length * log_histo[gmin]);
 }
 
 
-bool NFAFilter::filter (const BlurredSegment *bs, int start, int end)
+bool NFAFilter::filter (const BlurredSegment *bs, int start, int end) const
 {
   int length = end - start;
   if (length < min_section_length) return false;
@@ -105,7 +99,7 @@ bool NFAFilter::filter (const BlurredSegment *bs, int start, int end)
   // Gets point with small gradient
   int gmin = max_grad2;
 //  int pmin = -1;
-  std::vector<Pt2i> pts = bs->getAllPoints ();
+  const Pt2i *pts = bs->getPoints ();
   for (int i = start; i < end; i++)
   {
     int gn = (gradient_map->getValue (pts[i])).norm2 ();
@@ -117,8 +111,7 @@ bool NFAFilter::filter (const BlurredSegment *bs, int start, int end)
   }
 
   // Gets NFA and accept or split the segment
-  double nfa = nfaValue (cum_histo[(int) (sqrt (gmin))], length);
-  return (nfa < NFA_EPSILON);
+  return (logNfaValue ((int) (sqrt (gmin)), length) < log (NFA_EPSILON));
 //  if (nfa < NFA_EPSILON) return true;
 //  return (filter (bs, start, pmin) && filter (bs, pmin + 1, end));
 }
@@ -140,14 +133,20 @@ void NFAFilter::filter (const std::vector<BlurredSegment *> &bss,
     bs_section_count += length * (length - 1) / 2;
     it ++;
   }
+  log_section_count = log ((double) bs_section_count);
 
   // Computes and test each segment NFA
-  it = bss.begin ();
-  while (it != bss.end ())
+  int nb = (int) (bss.size ());
+  std::vector<char> valid (nb, 0);
+  #pragma omp parallel for schedule (dynamic, 64)
+  for (int i = 0; i < nb; i++)
+    valid[i] = (filter (bss[i], 0, bss[i]->size ()) ? 1 : 0);
+
+  // Dispatches the segments in the input order
+  for (int i = 0; i < nb; i++)
   {
-    if (filter (*it, 0, (*it)->size ())) vsegs.push_back (*it);
-    else rsegs.push_back (*it);
-    it ++;
+    if (valid[i]) vsegs.push_back (bss[i]);
+    else rsegs.push_back (bss[i]);
   }
 }
 
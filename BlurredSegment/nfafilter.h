@@ -87,21 +87,25 @@ private :
   int max_grad2;
   /** Reference to used gradient map. */
   VMap *gradient_map;
-  /** Cumulated gradient histogramm (H). */
-  double *cum_histo;
+  /** Logarithm of the cumulated gradient histogramm (log H). */
+  double *log_histo;
+  /** Size of the gradient histogram. */
+  int histo_size;
   /** Count of any blurred segment sections (Np). */
   int bs_section_count;
+  /** Logarithm of the count of blurred segment sections (log Np). */
+  double log_section_count;
 
   /** Division ratio applied to chain length for NFA test. */
   double lratio;
 
 
   /** 
-    * \brief Computes number of false alarms of a segment section.
-    * @param proba Validation probability associated to min gradient point.
+    * \brief Computes the logarithm of the number of false alarms.
+    * @param gmin Minimal gradient magnitude in the segment section.
     * @param length Section length.
     */
-  double nfaValue (double proba, int length);
+  double logNfaValue (int gmin, int length) const;
 
   /**
     * \brief Filters a blurred segment section.
@@ -109,7 +113,7 @@ private :
     * @param start Index of start point in the section.
     * @param end Index of first point out of the section.
     */
-  bool filter (const BlurredSegment *bs, int start, int end);
+  bool filter (const BlurredSegment *bs, int start, int end) const;
 
 };
 #endif
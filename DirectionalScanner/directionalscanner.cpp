@@ -19,14 +19,11 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
-#include <cstddef>
 #include "directionalscanner.h"
 
 
 DirectionalScanner::~DirectionalScanner ()
 {
-  if (steps != NULL) delete steps;
-  steps = NULL;
 }
 
 
@@ -29,6 +29,8 @@
  * @class DirectionalScanner directionalscanner.h
  * \brief Incremental directional scanner.
  * This scanner iterately provides parallel scan lines.
+ * Virtual interface to scanners shared between clients (see ScannerAdapter).
+ * Tracking loops directly use StripScanner values.
  */
 class DirectionalScanner
 {
@@ -112,95 +114,6 @@ public:
   /**
    * \brief Releases clearance status of output vector before filling.
    */
-  inline void releaseClearance () { clearance = false; }
-
-
-protected:
-
-  /** Scanable area left border. */
-  int xmin;
-  /** Scanable area bottom border. */
-  int ymin;
-  /** Scanable area right border. */
-  int xmax;
-  /** Scanable area top border. */
-  int ymax;
-
-  /** Parameter 'a' of the upper support discrete line. */
-  int dla;
-  /** Parameter 'b' of the upper support discrete line. */
-  int dlb;
-  /** Parameter 'c' of the upper support discrete line. */
-  int dlc2;
-
-  /** Size of the discrete line pattern. */
-  int nbs;
-
-  /** Discrete line pattern. */
-  bool *steps;
-  /** Pointer to the end of discrete line pattern. */
-  bool *fs;
-
-  /** X-start position of central scan (still used in locate (Pt2i)). */
-  int ccx;
-  /** Y-start position of central scan (still used in locate (Pt2i)). */
-  int ccy;
-  /** X-start position of last scan to the left. */
-  int lcx;
-  /** Y-start position of last scan to the left. */
-  int lcy;
-  /** X-start position of last scan to the right. */
-  int rcx;
-  /** Y-start position of last scan to the right. */
-  int rcy;
-
-  /** Current pattern step in scan line direction for left scans. */
-  bool *lst2;
-  /** Current pattern step in scan line direction for right scans. */
-  bool *rst2;
-
-  /** Flag indicating if the output vector should be cleared before filling.
-      Set to true by default. */
-  bool clearance;
-
-
-  /**
-   * \brief Creates an empty directional scanner.
-   */
-  DirectionalScanner () { }
-
-  /**
-   * \brief Creates an incremental directional scanner.
-   * Creates a directional scanner from pattern and start.
-   * The scan strip is composed of parallel scan lines, the first one being
-   *   defined by a start point and a line pattern.
-   * @param xmini Left border of the scan area.
-   * @param ymini Bottom border of the scan area.
-   * @param xmaxi Right border of the scan area.
-   * @param ymaxi Top border of the scan area.
-   * @param nb Size of the support line pattern.
-   * @param st Support line pattern.
-   * @param sx X-coordinate of the central scan start point.
-   * @param sy Y-coordinate of the central scan start point.
-   */
-  DirectionalScanner (int xmini, int ymini, int xmaxi, int ymaxi,
-                      int nb, bool* st, int sx, int sy)
-             : xmin (xmini), ymin (ymini), xmax (xmaxi), ymax (ymaxi),
-               nbs (nb), steps (st),
-               ccx (sx), ccy (sy), lcx (sx), lcy (sy), rcx (sx), rcy (sy),
-               clearance (true) { }
-
-  /**
-   * \brief Creates a copy of given directional scanner.
-   * @param ds Source directional scanner.
-   */
-  DirectionalScanner (DirectionalScanner *ds)
-         : xmin (ds->xmin), ymin (ds->ymin), xmax (ds->xmax), ymax (ds->ymax),
-           dla (ds->dla), dlb (ds->dlb), dlc2 (ds->dlc2),
-           nbs (ds->nbs), steps (ds->steps), fs (ds->fs),
-           ccx (ds->ccx), ccy (ds->ccy),
-           lcx (ds->lcx), lcy (ds->lcy), rcx (ds->rcx), rcy (ds->rcy),
-           lst2 (ds->lst2), rst2 (ds->rst2), clearance (ds->clearance) { }
-
+  virtual void releaseClearance () = 0;
 };
 #endif
@@ -0,0 +1,136 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SCANNER_ADAPTER_H
+#define SCANNER_ADAPTER_H
+
+#include "directionalscanner.h"
+#include "stripscanner.h"
+
+
+/** 
+ * @class ScannerAdapter scanneradapter.h
+ * \brief Directional scanner interface to a strip scanner.
+ * Provides heap allocated scanners to clients of the virtual interface.
+ */
+class ScannerAdapter : public DirectionalScanner
+{
+public:
+
+  /**
+   * \brief Creates an unset scanner adapter.
+   */
+  ScannerAdapter () { }
+
+  /**
+   * \brief Creates an adapter to a copy of given strip scanner.
+   * @param ds Source strip scanner.
+   */
+  ScannerAdapter (const StripScanner &ds) : sc (ds) { }
+
+  /**
+   * \brief Returns the adapted strip scanner.
+   */
+  inline StripScanner &scanner () { return sc; }
+
+  /**
+   * \brief Returns a copy of the directional scanner.
+   */
+  DirectionalScanner *getCopy () { return (new ScannerAdapter (sc)); }
+
+  /**
+   * \brief Gets the central scan in a vector.
+   * Adds central scan points to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   */
+  int first (std::vector<Pt2i> &scan) const { return (sc.first (scan)); }
+
+  /**
+   * \brief Gets next scan on the left in a vector.
+   * Adds points of next left scan to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   */
+  int nextOnLeft (std::vector<Pt2i> &scan) { return (sc.nextOnLeft (scan)); }
+
+  /**
+   * \brief Gets next scan on the right in a vector.
+   * Adds points of next right scan to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   */
+  int nextOnRight (std::vector<Pt2i> &scan) {
+    return (sc.nextOnRight (scan)); }
+
+  /**
+   * \brief Gets next skipped scan to the left in a vector.
+   * Adds points of next left scan to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   * @param skip Skip length.
+   */
+  int skipLeft (std::vector<Pt2i> &scan, int skip) {
+    return (sc.skipLeft (scan, skip)); }
+
+  /**
+   * \brief Gets next skipped scan to the right in a vector.
+   * Adds points of next right scan to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   * @param skip Skip length.
+   */
+  int skipRight (std::vector<Pt2i> &scan, int skip) {
+    return (sc.skipRight (scan, skip)); }
+
+  /**
+   * \brief Skips scans to the left.
+   * @param skip Skip length.
+   */
+  void skipLeft (int skip) { sc.skipLeft (skip); }
+
+  /**
+   * \brief Skips scans to the right.
+   * @param skip Skip length.
+   */
+  void skipRight (int skip) { sc.skipRight (skip); }
+
+  /**
+   * \brief Binds the scan strip to wrap the given digital line.
+   * @param a New value for the 'a' parameter of current scan strip.
+   * @param b New value for the 'b' parameter of current scan strip.
+   * @param c New value for the 'c' parameter of current scan strip.
+   */
+  void bindTo (int a, int b, int c) { sc.bindTo (a, b, c); }
+
+  /**
+   * \brief Returns the scanner coordinates of given point.
+   * @param pt Image coordinates of the point.
+   */
+  Pt2i locate (const Pt2i &pt) const { return (sc.locate (pt)); }
+
+  /**
+   * \brief Releases clearance status of output vector before filling.
+   */
+  void releaseClearance () { sc.releaseClearance (); }
+
+
+private:
+
+  /** Adapted strip scanner. */
+  StripScanner sc;
+};
+#endif
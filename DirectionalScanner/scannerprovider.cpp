@@ -19,19 +19,32 @@
     along with this program.  If not, see <https://www.gnu.org/licenses/>.
 */
 
+#include <cstddef>
 #include "scannerprovider.h"
-#include "directionalscannero2.h"
-#include "directionalscannero7.h"
-#include "directionalscannero1.h"
-#include "directionalscannero8.h"
-#include "vhscannero2.h"
-#include "vhscannero7.h"
-#include "vhscannero1.h"
-#include "vhscannero8.h"
+#include "scanneradapter.h"
+#include "steppatterns.h"
 
 
 DirectionalScanner *ScannerProvider::getScanner (Pt2i p1, Pt2i p2,
                                                  bool adaptive)
+{
+  ScannerAdapter *ds = new ScannerAdapter ();
+  setScanner (ds->scanner (), p1, p2, adaptive);
+  return (ds);
+}
+
+
+DirectionalScanner *ScannerProvider::getScanner (Pt2i centre, Vr2i normal,
+                                                 int length, bool adaptive)
+{
+  ScannerAdapter *ds = new ScannerAdapter ();
+  setScanner (ds->scanner (), centre, normal, length, adaptive);
+  return (ds);
+}
+
+
+void ScannerProvider::setScanner (StripScanner &ds, Pt2i p1, Pt2i p2,
+                                  bool adaptive)
 {
   // Enforces P1 to be lower than P2
   // or to left of P2 in case of equality
@@ -44,9 +57,16 @@ DirectionalScanner *ScannerProvider::getScanner (Pt2i p1, Pt2i p2,
     p2.set (tmp);
   }
 
-  // Computes the steps position array
+  // Gets the steps position array
   int nbs = 0;
-  bool *steps = p1.stepsTo (p2, &nbs);
+  bool own = false;
+  const bool *steps = StepPatterns::pattern (p2.x () - p1.x (),
+                                             p2.y () - p1.y (), &nbs);
+  if (steps == NULL)
+  {
+    steps = p1.stepsTo (p2, &nbs);
+    own = true;
+  }
 
   // Equation of the strip support lines : ax + by = c
   int a = p2.x () - p1.x ();
@@ -57,88 +77,72 @@ DirectionalScanner *ScannerProvider::getScanner (Pt2i p1, Pt2i p2,
     b = -b;
   }
   int c2 = a * p2.x () + b * p2.y ();
+  int mode = (adaptive ? StripScanner::ADAPTIVE : StripScanner::STATIC);
+  int sx = p1.x (), sy = p1.y ();
 
-  // Builds and returns the appropriate scanner
+  // Sets the appropriate scanner
+  int octant = 0;
   if (b < 0)
     if (-b > a)
     {
+      octant = 1;
       if (isOrtho)
       {
-        int repx = (p1.x () + p2.x ()) / 2;    // central scan start
-        int repy = p1.y () - (int) ((p1.x () - repx) * (p1.x () - p2.x ())
-                                    / (p2.y () - p1.y ()));
-        return (new VHScannerO1 (xmin, ymin, xmax, ymax,
-                                 a, b, c2, nbs, steps, repx, repy));
+        sx = (p1.x () + p2.x ()) / 2;    // central scan start
+        sy = p1.y () - (int) ((p1.x () - sx) * (p1.x () - p2.x ())
+                              / (p2.y () - p1.y ()));
       }
-      else return (adaptive ?
-                   (DirectionalScanner *)
-                   new AdaptiveScannerO1 (xmin, ymin, xmax, ymax,
-                          a, b, c2, nbs, steps, p1.x (), p1.y ()) :
-                   new DirectionalScannerO1 (xmin, ymin, xmax, ymax,
-                          a, b, c2, nbs, steps, p1.x (), p1.y ()));
     }
     else
     {
+      octant = 2;
       if (isOrtho)
       {
-        int repy = (p1.y () + p2.y ()) / 2;    // central scan start
-        int repx = p1.x () + (int) ((repy - p1.y ()) * (p2.y () - p1.y ())
-                                    / (p1.x () - p2.x ()));
-        return (new VHScannerO2 (xmin, ymin, xmax, ymax,
-                                 a, b, c2, nbs, steps, repx, repy));
+        sy = (p1.y () + p2.y ()) / 2;    // central scan start
+        sx = p1.x () + (int) ((sy - p1.y ()) * (p2.y () - p1.y ())
+                              / (p1.x () - p2.x ()));
       }
-      else return (adaptive ?
-                   (DirectionalScanner *)
-                   new AdaptiveScannerO2 (xmin, ymin, xmax, ymax,
-                          a, b, c2, nbs, steps, p1.x (), p1.y ()) :
-                   new DirectionalScannerO2 (xmin, ymin, xmax, ymax,
-                          a, b, c2, nbs, steps, p1.x (), p1.y ()));
     }
   else
     if (b > a)
     {
+      octant = 8;
       if (isOrtho)
       {
-        int repx = (p1.x () + p2.x ()) / 2;    // central scan start
-        int repy = p1.y () - (int) ((repx - p1.x ()) * (p2.x () - p1.x ())
-                                    / (p2.y () - p1.y ()));
-        return (new VHScannerO8 (xmin, ymin, xmax, ymax,
-                                 a, b, c2, nbs, steps, repx, repy));
+        sx = (p1.x () + p2.x ()) / 2;    // central scan start
+        sy = p1.y () - (int) ((sx - p1.x ()) * (p2.x () - p1.x ())
+                              / (p2.y () - p1.y ()));
       }
-      else return (adaptive ?
-                   (DirectionalScanner *)
-                   new AdaptiveScannerO8 (xmin, ymin, xmax, ymax,
-                          a, b, c2, nbs, steps, p1.x (), p1.y ()) :
-                   new DirectionalScannerO8 (xmin, ymin, xmax, ymax,
-                          a, b, c2, nbs, steps, p1.x (), p1.y ()));
     }
     else
     {
+      octant = 7;
       if (isOrtho)
       {
-        int repy = (p1.y () + p2.y ()) / 2;    // central scan start
-        int repx = p1.x () - (int) ((repy - p1.y ()) * (p2.y () - p1.y ())
-                                    / (p2.x () - p1.x ()));
-        return (new VHScannerO7 (xmin, ymin, xmax, ymax,
-                                 a, b, c2, nbs, steps, repx, repy));
+        sy = (p1.y () + p2.y ()) / 2;    // central scan start
+        sx = p1.x () - (int) ((sy - p1.y ()) * (p2.y () - p1.y ())
+                              / (p2.x () - p1.x ()));
       }
-      else return (adaptive ?
-                   (DirectionalScanner *)
-                   new AdaptiveScannerO7 (xmin, ymin, xmax, ymax,
-                          a, b, c2, nbs, steps, p1.x (), p1.y ()) :
-                   new DirectionalScannerO7 (xmin, ymin, xmax, ymax,
-                          a, b, c2, nbs, steps, p1.x (), p1.y ()));
     }
+  if (isOrtho) mode = StripScanner::ORTHO;
+  ds.set (octant, mode, xmin, ymin, xmax, ymax,
+          a, b, c2, nbs, steps, own, sx, sy);
 }
 
 
-DirectionalScanner *ScannerProvider::getScanner (Pt2i centre, Vr2i normal,
-                                                 int length, bool adaptive)
+void ScannerProvider::setScanner (StripScanner &ds, Pt2i centre,
+                                  Vr2i normal, int length, bool adaptive)
 {
   // Gets the steps position array
   int nbs = 0;
-  bool *steps = centre.stepsTo (Pt2i (centre.x () + normal.x (),
-                                      centre.y () + normal.y ()), &nbs);
+  bool own = false;
+  const bool *steps = StepPatterns::pattern (normal.x (), normal.y (), &nbs);
+  if (steps == NULL)
+  {
+    steps = centre.stepsTo (Pt2i (centre.x () + normal.x (),
+                                  centre.y () + normal.y ()), &nbs);
+    own = true;
+  }
 
   // Orients rightwards
   int a = normal.x ();
@@ -150,69 +154,13 @@ DirectionalScanner *ScannerProvider::getScanner (Pt2i centre, Vr2i normal,
     b = -b;
   }
 
-  // Builds and returns the appropriate scanner
-  if (b < 0)
-    if (-b > a)
-      return (adaptive ?
-              (isOrtho ?
-               (DirectionalScanner *)
-               new VHScannerO1 (xmin, ymin, xmax, ymax,
-                                a, b, nbs, steps,
-                                centre.x (), centre.y (), length) :
-               (DirectionalScanner *)
-               new AdaptiveScannerO1 (xmin, ymin, xmax, ymax,
-                                      a, b, nbs, steps,
-                                      centre.x (), centre.y (), length)) :
-              (DirectionalScanner *)
-              new DirectionalScannerO1 (xmin, ymin, xmax, ymax,
-                                        a, b, nbs, steps,
-                                        centre.x (), centre.y (), length));
-    else
-      return (adaptive ?
-              (isOrtho ?
-               (DirectionalScanner *)
-               new VHScannerO2 (xmin, ymin, xmax, ymax,
-                                a, b, nbs, steps,
-                                centre.x (), centre.y (), length) :
-               (DirectionalScanner *)
-               new AdaptiveScannerO2 (xmin, ymin, xmax, ymax,
-                                      a, b, nbs, steps,
-                                      centre.x (), centre.y (), length)) :
-              (DirectionalScanner *)
-              new DirectionalScannerO2 (xmin, ymin, xmax, ymax,
-                                        a, b, nbs, steps,
-                                        centre.x (), centre.y (), length));
-  else
-    if (b > a)
-      return (adaptive ?
-              (isOrtho ?
-               (DirectionalScanner *)
-               new VHScannerO8 (xmin, ymin, xmax, ymax,
-                                a, b, nbs, steps,
-                                centre.x (), centre.y (), length) :
-               (DirectionalScanner *)
-               new AdaptiveScannerO8 (xmin, ymin, xmax, ymax,
-                                      a, b, nbs, steps,
-                                      centre.x (), centre.y (), length)) :
-              (DirectionalScanner *)
-              new DirectionalScannerO8 (xmin, ymin, xmax, ymax,
-                                        a, b, nbs, steps,
-                                        centre.x (), centre.y (), length));
-    else
-      return (adaptive ?
-              (isOrtho ?
-               (DirectionalScanner *)
-               new VHScannerO7 (xmin, ymin, xmax, ymax,
-                                a, b, nbs, steps,
-                                centre.x (), centre.y (), length) :
-               (DirectionalScanner *)
-               new AdaptiveScannerO7 (xmin, ymin, xmax, ymax,
-                                      a, b, nbs, steps,
-                                      centre.x (), centre.y (), length)) :
-              (DirectionalScanner *)
-              new DirectionalScannerO7 (xmin, ymin, xmax, ymax,
-                                        a, b, nbs, steps,
-                                        centre.x (), centre.y (), length));
+  // Sets the appropriate scanner
+  int octant = (b < 0 ? (-b > a ? 1 : 2) : (b > a ? 8 : 7));
+  int mode = (adaptive ? (isOrtho ? StripScanner::ORTHO
+                                  : StripScanner::ADAPTIVE)
+                       : StripScanner::STATIC);
+  ds.set (octant, mode, xmin, ymin, xmax, ymax,
+          a, b, nbs, steps, own, centre.x (), centre.y (), length);
 }
 
 
@@ -23,6 +23,7 @@
 #define SCANNER_PROVIDER_H
 
 #include "directionalscanner.h"
+#include "stripscanner.h"
 
 
 /** 
@@ -82,6 +83,35 @@ public:
   DirectionalScanner *getScanner (Pt2i centre, Vr2i normal,
                                   int length, bool adaptive = false);
 
+  /**
+   * \brief Sets a directional scanner from initial scan end points.
+   * Sets given scanner from two control points, in place of getScanner
+   *   when the scanner is used as a local value.
+   * The scan strip is composed of parallel scans (line segments),
+   *   the initial one being defined by control points p1 and p2.
+   * @param ds Directional scanner to set.
+   * @param p1 Initial scan start point.
+   * @param p2 Initial scan end point.
+   * @param adaptive Directional scanner adaption modality.
+   */
+  void setScanner (StripScanner &ds, Pt2i p1, Pt2i p2,
+                   bool adaptive = false);
+
+  /**
+   * \brief Sets a directional scanner from scan center, vector and length.
+   * Sets given scanner in place of getScanner when the scanner is used
+   *   as a local value.
+   * The scan strip is composed of parallel scans (line segments),
+   *   the first one defined by its center, its direct vector, and its length.
+   * @param ds Directional scanner to set.
+   * @param centre Initial scan center.
+   * @param normal Initial scan director vector.
+   * @param length Initial scan length.
+   * @param adaptive Directional scanner adaption modality.
+   */
+  void setScanner (StripScanner &ds, Pt2i centre, Vr2i normal,
+                   int length, bool adaptive = false);
+
   /**
    * \brief Returns whether the input vector (P1P2 or normal) has been reversed.
    */
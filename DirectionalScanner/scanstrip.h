@@ -0,0 +1,110 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SCAN_STRIP_H
+#define SCAN_STRIP_H
+
+#include <vector>
+
+
+/** 
+ * @class ScanStrip scanstrip.h
+ * \brief Flat storage of a bundle of consecutive parallel scans.
+ * Point coordinates are stored in two contiguous arrays, and scan bounds
+ *   in an offset array : scan k spans indices [start (k), end (k)).
+ * Buffers are kept between uses so that the strip can be refilled
+ *   without any allocation once its capacity is reached.
+ */
+class ScanStrip
+{
+public:
+
+  /**
+   * \brief Creates an empty scan strip.
+   */
+  ScanStrip () { offs.push_back (0); }
+
+  /**
+   * \brief Removes all scans from the strip, keeping its capacity.
+   */
+  inline void clear () { xs.clear (); ys.clear (); offs.resize (1); }
+
+  /**
+   * \brief Returns the count of points in the strip.
+   */
+  inline int size () const { return ((int) (xs.size ())); }
+
+  /**
+   * \brief Returns whether the strip holds no point.
+   */
+  inline bool empty () const { return (xs.empty ()); }
+
+  /**
+   * \brief Returns the count of scans in the strip.
+   */
+  inline int countOfScans () const { return ((int) (offs.size ()) - 1); }
+
+  /**
+   * \brief Returns the index of first point of a scan.
+   * @param k Scan index.
+   */
+  inline int start (int k) const { return (offs[k]); }
+
+  /**
+   * \brief Returns the index following last point of a scan.
+   * @param k Scan index.
+   */
+  inline int end (int k) const { return (offs[k + 1]); }
+
+  /**
+   * \brief Returns the array of point X-coordinates.
+   */
+  inline const int *xData () const { return (xs.data ()); }
+
+  /**
+   * \brief Returns the array of point Y-coordinates.
+   */
+  inline const int *yData () const { return (ys.data ()); }
+
+  /**
+   * \brief Appends a point to the current scan.
+   * @param x Point X-coordinate.
+   * @param y Point Y-coordinate.
+   */
+  inline void add (int x, int y) { xs.push_back (x); ys.push_back (y); }
+
+  /**
+   * \brief Closes the current scan with the points added since last closure.
+   */
+  inline void closeScan () { offs.push_back ((int) (xs.size ())); }
+
+
+private:
+
+  /** Point X-coordinates. */
+  std::vector<int> xs;
+  /** Point Y-coordinates. */
+  std::vector<int> ys;
+  /** Scan start offsets, followed by the strip size. */
+  std::vector<int> offs;
+};
+
+#endif
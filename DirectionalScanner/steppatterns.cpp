@@ -0,0 +1,79 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <cstddef>
+#include "steppatterns.h"
+#include "pt2i.h"
+
+
+std::atomic<const bool *> StepPatterns::patterns[2 * (MAX_COORD + 1)
+                                                   * (MAX_COORD + 1)];
+std::atomic<int> StepPatterns::count (0);
+
+
+const bool *StepPatterns::pattern (int dx, int dy, int *n)
+{
+  bool opposite = ((dx < 0) != (dy < 0));
+  if (dx < 0) dx = -dx;
+  if (dy < 0) dy = -dy;
+  int g = dx, r = dy;
+  while (r != 0)
+  {
+    int t = g % r;
+    g = r;
+    r = t;
+  }
+  if (g == 0) return NULL;
+  dx /= g;
+  dy /= g;
+  if (dx > MAX_COORD || dy > MAX_COORD) return NULL;
+
+  // Null coordinates give flat patterns whatever the sign parity
+  if (dx == 0 || dy == 0) opposite = false;
+  std::atomic<const bool *> &entry
+    = patterns[((opposite ? MAX_COORD + 1 : 0) + dx) * (MAX_COORD + 1) + dy];
+  const bool *pat = entry.load (std::memory_order_acquire);
+  if (pat == NULL)
+  {
+    bool *built = Pt2i (0, 0).stepsTo (Pt2i (opposite ? -dx : dx, dy), n);
+    const bool *expected = NULL;
+    if (entry.compare_exchange_strong (expected, built,
+                                       std::memory_order_acq_rel))
+    {
+      count ++;
+      pat = built;
+    }
+    else
+    {
+      // Another thread cached the same pattern meanwhile
+      delete [] built;
+      pat = expected;
+    }
+  }
+  *n = (dx > dy ? dx : dy);
+  return (pat);
+}
+
+
+int StepPatterns::countOfPatterns ()
+{
+  return (count.load ());
+}
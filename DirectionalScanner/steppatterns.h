@@ -0,0 +1,67 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STEP_PATTERNS_H
+#define STEP_PATTERNS_H
+
+#include <atomic>
+
+
+/** 
+ * @class StepPatterns steppatterns.h
+ * \brief Shared cache of discrete line step patterns.
+ * The step pattern of a direction vector (a, b) repeats the pattern of the
+ *   reduced vector (a/g, b/g), g = gcd (a, b). Reduced patterns of short
+ *   vectors are built once, then shared read-only by all scanners in all
+ *   threads.
+ */
+class StepPatterns
+{
+public:
+
+  /** Largest coordinate of cached reduced direction vectors. */
+  static const int MAX_COORD = 128;
+
+  /**
+   * \brief Returns the shared step pattern of given direction vector.
+   * Returns NULL if the reduced vector is too long to be cached.
+   * Same pattern as Pt2i::stepsTo, but restricted to its reduced period.
+   * @param dx Direction vector X-coordinate.
+   * @param dy Direction vector Y-coordinate.
+   * @param n Size of the returned pattern.
+   */
+  static const bool *pattern (int dx, int dy, int *n);
+
+  /**
+   * \brief Returns the count of cached patterns.
+   */
+  static int countOfPatterns ();
+
+
+private:
+
+  /** Cached patterns, indexed by reduced vector and sign parity. */
+  static std::atomic<const bool *> patterns[2 * (MAX_COORD + 1)
+                                              * (MAX_COORD + 1)];
+  /** Count of cached patterns. */
+  static std::atomic<int> count;
+};
+#endif
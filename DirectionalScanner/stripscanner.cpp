@@ -0,0 +1,302 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include "stripscanner.h"
+
+
+const int StripScanner::OCTANTS[4] = { 1, 2, 7, 8 };
+
+
+StripScanner::StripScanner ()
+             : kind (0), nbs (0), steps (NULL), owned (false), fs (NULL),
+               clearance (true)
+{
+}
+
+
+StripScanner::StripScanner (const StripScanner &ds)
+{
+  copy (ds);
+}
+
+
+StripScanner::~StripScanner ()
+{
+  if (owned) delete [] steps;
+}
+
+
+StripScanner &StripScanner::operator= (const StripScanner &ds)
+{
+  if (this != &ds)
+  {
+    if (owned) delete [] steps;
+    copy (ds);
+  }
+  return (*this);
+}
+
+
+void StripScanner::copy (const StripScanner &ds)
+{
+  kind = ds.kind;
+  xmin = ds.xmin;
+  ymin = ds.ymin;
+  xmax = ds.xmax;
+  ymax = ds.ymax;
+  dla = ds.dla;
+  dlb = ds.dlb;
+  dlc1 = ds.dlc1;
+  dlc2 = ds.dlc2;
+  templ_a = ds.templ_a;
+  templ_b = ds.templ_b;
+  templ_nu = ds.templ_nu;
+  nbs = ds.nbs;
+  ccx = ds.ccx;
+  ccy = ds.ccy;
+  lcx = ds.lcx;
+  lcy = ds.lcy;
+  rcx = ds.rcx;
+  rcy = ds.rcy;
+  lstop = ds.lstop;
+  rstop = ds.rstop;
+  clearance = ds.clearance;
+  owned = ds.owned;
+  if (ds.steps == NULL)
+  {
+    steps = NULL;
+    fs = NULL;
+  }
+  else
+  {
+    if (owned)
+    {
+      bool *st = new bool[nbs];
+      memcpy (st, ds.steps, nbs * sizeof (bool));
+      steps = st;
+    }
+    else steps = ds.steps;
+    fs = steps + nbs;
+    lst1 = steps + (ds.lst1 - ds.steps);
+    rst1 = steps + (ds.rst1 - ds.steps);
+    lst2 = steps + (ds.lst2 - ds.steps);
+    rst2 = steps + (ds.rst2 - ds.steps);
+  }
+}
+
+
+void StripScanner::set (int octant, int mode,
+                        int xmini, int ymini, int xmaxi, int ymaxi,
+                        int a, int b, int c,
+                        int nb, const bool *st, bool own, int sx, int sy)
+{
+  if (owned) delete [] steps;
+  kind = 3 * (octant == 1 ? 0 : (octant == 2 ? 1 : (octant == 7 ? 2 : 3)))
+         + mode;
+  xmin = xmini;
+  ymin = ymini;
+  xmax = xmaxi;
+  ymax = ymaxi;
+  dla = a;
+  dlb = b;
+  dlc2 = c;
+  dlc1 = a * sx + b * sy;
+  templ_a = a;
+  templ_b = b;
+  templ_nu = (octant <= 2 ? dlc1 - dlc2 : dlc2 - dlc1);
+  nbs = nb;
+  steps = st;
+  owned = own;
+  fs = steps + nbs;
+  ccx = sx;
+  ccy = sy;
+  lcx = sx;
+  lcy = sy;
+  rcx = sx;
+  rcy = sy;
+  lst1 = steps;
+  rst1 = steps;
+  lst2 = steps;
+  rst2 = steps;
+  lstop = false;
+  rstop = false;
+  clearance = true;
+}
+
+
+void StripScanner::set (int octant, int mode,
+                        int xmini, int ymini, int xmaxi, int ymaxi,
+                        int a, int b, int nb, const bool *st, bool own,
+                        int cx, int cy, int length)
+{
+  set (octant, mode, xmini, ymini, xmaxi, ymaxi,
+       a, b, 0, nb, st, own, cx, cy);
+  switch (kind)
+  {
+    case 0 : center<1,STATIC> (length); break;
+    case 1 : center<1,ADAPTIVE> (length); break;
+    case 2 : center<1,ORTHO> (length); break;
+    case 3 : center<2,STATIC> (length); break;
+    case 4 : center<2,ADAPTIVE> (length); break;
+    case 5 : center<2,ORTHO> (length); break;
+    case 6 : center<7,STATIC> (length); break;
+    case 7 : center<7,ADAPTIVE> (length); break;
+    case 8 : center<7,ORTHO> (length); break;
+    case 9 : center<8,STATIC> (length); break;
+    case 10 : center<8,ADAPTIVE> (length); break;
+    default : center<8,ORTHO> (length);
+  }
+}
+
+
+template <int OCT, int MODE> void StripScanner::center (int length)
+{
+  typedef ScanOctant<OCT> O;
+  int w_2 = (length + 1) / 2;
+
+  // Looking for the central scan start position
+  const bool *st = fs;
+  for (int i = 0; i < w_2; i++)
+  {
+    if (MODE != ORTHO)
+    {
+      if (--st < steps) st = fs - 1;
+      if (*st)
+      {
+        lcx -= O::SX;
+        lcy -= O::SY;
+      }
+    }
+    lcx -= O::MX;
+    lcy -= O::MY;
+  }
+  dlc1 = dla * lcx + dlb * lcy;
+  if (MODE != ORTHO)
+  {
+    lst2 = st;
+    rst2 = st;
+  }
+
+  // Looking for the upper leaning line
+  int cx = ccx, cy = ccy;
+  st = steps;
+  while (w_2-- > 0)
+  {
+    if (MODE != ORTHO)
+    {
+      if (*st)
+      {
+        cx += O::SX;
+        cy += O::SY;
+      }
+      if (++st >= fs) st = steps;
+    }
+    cx += O::MX;
+    cy += O::MY;
+  }
+  dlc2 = dla * cx + dlb * cy;
+  templ_nu = (O::GE ? dlc1 - dlc2 : dlc2 - dlc1);
+  rcx = lcx;
+  rcy = lcy;
+  ccx = lcx;
+  ccy = lcy;
+}
+
+
+Pt2i StripScanner::locate (const Pt2i &pt) const
+{
+  switch (kind)
+  {
+    case 0 : return (locate<1> (pt));
+    case 3 : return (locate<2> (pt));
+    case 6 : return (locate<7> (pt));
+    case 9 : return (locate<8> (pt));
+    default : return (Pt2i (pt));
+  }
+}
+
+
+template <int OCT> Pt2i StripScanner::locate (const Pt2i &pt) const
+{
+  typedef ScanOctant<OCT> O;
+  int x = ccx, y = ccy;      // Current position coordinates
+  const bool *nst = steps;   // Current step in scan direction (jpts)
+
+  if ((pt.x () - x) * O::MX + (pt.y () - y) * O::MY >= 0)
+  {
+    // Climbs the first scan up
+    while ((pt.x () - x) * O::MX + (pt.y () - y) * O::MY > 0)
+    {
+      if (*nst)
+      {
+        x += O::SX;
+        y += O::SY;
+      }
+      x += O::MX;
+      y += O::MY;
+      if (++nst >= fs) nst = steps;
+    }
+  }
+  else
+  {
+    // Climbs the first scan down
+    while ((pt.x () - x) * O::MX + (pt.y () - y) * O::MY < 0)
+    {
+      x -= O::MX;
+      y -= O::MY;
+      if (--nst < steps) nst = fs - 1;
+      if (*nst)
+      {
+        x -= O::SX;
+        y -= O::SY;
+      }
+    }
+  }
+  // Scan index grows rightwards
+  int ci = (O::LEFT_A ? (pt.x () - x) * O::SX + (pt.y () - y) * O::SY
+                      : (x - pt.x ()) * O::SX + (y - pt.y ()) * O::SY);
+
+  // Comes back to scan origin
+  x = ccx;
+  y = ccy;
+  const bool *st1 = steps;
+  const bool *st2 = steps;
+  bool trans = false;
+  int n = ci;
+  while (n != 0)
+  {
+    if (ci < 0)
+    {
+      // Jumps leftwards along scan bound
+      step<OCT,true> (x, y, st1, st2, trans);
+      n ++;
+    }
+    else
+    {
+      // Jumps rightwards along scan bound
+      step<OCT,false> (x, y, st1, st2, trans);
+      n --;
+    }
+  }
+  return (Pt2i (ci, (pt.x () - x) * O::MX + (pt.y () - y) * O::MY));
+}
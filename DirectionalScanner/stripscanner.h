@@ -0,0 +1,779 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef STRIP_SCANNER_H
+#define STRIP_SCANNER_H
+
+#include <vector>
+#include "pt2i.h"
+#include "scanstrip.h"
+
+
+/** 
+ * @struct ScanOctant stripscanner.h
+ * \brief Compile-time geometry of a scan strip octant.
+ * MX, MY : main direction of the scans (one pixel move).
+ * SX, SY : secondary direction, followed on scan pattern steps.
+ * GE : the scans lie on the positive side of the upper support line.
+ * LEFT_A : left scans are reached by a move opposite to the secondary
+ *   direction (otherwise right scans are).
+ * KEEP_B : sign of parameter 'b' of the support lines to be kept on binding
+ *   to avoid the direction change of the support line inequations.
+ */
+template <int OCT> struct ScanOctant { };
+template <> struct ScanOctant<1> {
+  enum { MX = 0, MY = 1, SX = -1, SY = 0, GE = 1, LEFT_A = 0,
+         KEEP_B = -1 }; };
+template <> struct ScanOctant<2> {
+  enum { MX = -1, MY = 0, SX = 0, SY = 1, GE = 1, LEFT_A = 1,
+         KEEP_B = 0 }; };
+template <> struct ScanOctant<7> {
+  enum { MX = 1, MY = 0, SX = 0, SY = 1, GE = 0, LEFT_A = 0,
+         KEEP_B = 0 }; };
+template <> struct ScanOctant<8> {
+  enum { MX = 0, MY = 1, SX = 1, SY = 0, GE = 0, LEFT_A = 1,
+         KEEP_B = 1 }; };
+
+
+/** Calls the template instance of a scan method matching scanner kind. */
+#define STRIP_SCANNER_DISPATCH(call,args) \
+  switch (kind) \
+  { \
+    case 0 : call<1,STATIC> args; break; \
+    case 1 : call<1,ADAPTIVE> args; break; \
+    case 2 : call<1,ORTHO> args; break; \
+    case 3 : call<2,STATIC> args; break; \
+    case 4 : call<2,ADAPTIVE> args; break; \
+    case 5 : call<2,ORTHO> args; break; \
+    case 6 : call<7,STATIC> args; break; \
+    case 7 : call<7,ADAPTIVE> args; break; \
+    case 8 : call<7,ORTHO> args; break; \
+    case 9 : call<8,STATIC> args; break; \
+    case 10 : call<8,ADAPTIVE> args; break; \
+    default : call<8,ORTHO> args; \
+  }
+
+
+/** 
+ * @class StripScanner stripscanner.h
+ * \brief Incremental directional scanner, usable as a plain value.
+ * This scanner iterately provides parallel scan lines.
+ * Octant and scan modality (static, adaptive or vertical/horizontal)
+ *   are set by the scanner provider. They select a template instance
+ *   of each scan method, where all moves and tests are resolved at
+ *   compile time. The scanner is thus inlined in tracking loops,
+ *   without any heap allocation or virtual call.
+ */
+class StripScanner
+{
+public:
+
+  /** Static scan modality (parallel scans along the initial pattern). */
+  static const int STATIC = 0;
+  /** Adaptive scan modality (scans follow a control line). */
+  static const int ADAPTIVE = 1;
+  /** Vertical / horizontal adaptive scan modality. */
+  static const int ORTHO = 2;
+
+
+  /**
+   * \brief Creates an unset directional scanner.
+   */
+  StripScanner ();
+
+  /**
+   * \brief Creates a copy of given directional scanner.
+   * @param ds Source directional scanner.
+   */
+  StripScanner (const StripScanner &ds);
+
+  /**
+   * \brief Deletes the directional scanner.
+   */
+  ~StripScanner ();
+
+  /**
+   * \brief Copies given directional scanner.
+   * @param ds Source directional scanner.
+   */
+  StripScanner &operator= (const StripScanner &ds);
+
+  /**
+   * \brief Sets the scanner from pattern, start and upper bound.
+   * The scan strip is composed of parallel scan lines, the first one being
+   *   defined by a start point, a line pattern, and an upper bound.
+   * @param octant Scan strip octant (1, 2, 7 or 8).
+   * @param mode Scan modality (STATIC, ADAPTIVE or ORTHO).
+   * @param xmini Left border of the scan area.
+   * @param ymini Bottom border of the scan area.
+   * @param xmaxi Right border of the scan area.
+   * @param ymaxi Top border of the scan area.
+   * @param a Value of parameter 'a' of the discrete support line.
+   * @param b Value of parameter 'b' of the discrete support line.
+   * @param c Value of parameter 'c' of the upper bounding line.
+   * @param nb Size of the support line pattern.
+   * @param st Support line pattern.
+   * @param own Pattern ownership : deleted with the scanner if true.
+   * @param sx X-coordinate of the central scan start point.
+   * @param sy Y-coordinate of the central scan start point.
+   */
+  void set (int octant, int mode,
+            int xmini, int ymini, int xmaxi, int ymaxi,
+            int a, int b, int c, int nb, const bool *st, bool own,
+            int sx, int sy);
+
+  /**
+   * \brief Sets the scanner from pattern, center and length.
+   * The scan strip is composed of parallel scan lines, the first one being
+   *   defined by a center, a line pattern, and a length value.
+   * @param octant Scan strip octant (1, 2, 7 or 8).
+   * @param mode Scan modality (STATIC, ADAPTIVE or ORTHO).
+   * @param xmini Left border of the scan area.
+   * @param ymini Bottom border of the scan area.
+   * @param xmaxi Right border of the scan area.
+   * @param ymaxi Top border of the scan area.
+   * @param a Value of parameter 'a' of the discrete support line.
+   * @param b Value of parameter 'b' of the discrete support line.
+   * @param nb Size of the support line pattern.
+   * @param st Support line pattern.
+   * @param own Pattern ownership : deleted with the scanner if true.
+   * @param cx X-coordinate of the central scan center.
+   * @param cy Y-coordinate of the central scan center.
+   * @param length Length of a scan strip.
+   */
+  void set (int octant, int mode,
+            int xmini, int ymini, int xmaxi, int ymaxi,
+            int a, int b, int nb, const bool *st, bool own,
+            int cx, int cy, int length);
+
+  /**
+   * \brief Gets the central scan in a vector.
+   * Adds central scan points to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   */
+  inline int first (std::vector<Pt2i> &scan) const {
+    STRIP_SCANNER_DISPATCH (return fill, (scan, lcx, lcy, lst2)) }
+
+  /**
+   * \brief Gets next scan on the left in a vector.
+   * Adds points of next left scan to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   */
+  inline int nextOnLeft (std::vector<Pt2i> &scan) {
+    STRIP_SCANNER_DISPATCH (return skipLeft, (scan, 1)) }
+
+  /**
+   * \brief Gets next scan on the right in a vector.
+   * Adds points of next right scan to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   */
+  inline int nextOnRight (std::vector<Pt2i> &scan) {
+    STRIP_SCANNER_DISPATCH (return skipRight, (scan, 1)) }
+
+  /**
+   * \brief Gets next skipped scan to the left in a vector.
+   * Adds points of next left scan to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   * @param skip Skip length.
+   */
+  inline int skipLeft (std::vector<Pt2i> &scan, int skip) {
+    STRIP_SCANNER_DISPATCH (return skipLeft, (scan, skip)) }
+
+  /**
+   * \brief Gets next skipped scan to the right in a vector.
+   * Adds points of next right scan to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   * @param skip Skip length.
+   */
+  inline int skipRight (std::vector<Pt2i> &scan, int skip) {
+    STRIP_SCANNER_DISPATCH (return skipRight, (scan, skip)) }
+
+  /**
+   * \brief Skips scans to the left.
+   * @param skip Skip length.
+   */
+  inline void skipLeft (int skip) {
+    STRIP_SCANNER_DISPATCH (move, (skip, true)) }
+
+  /**
+   * \brief Skips scans to the right.
+   * @param skip Skip length.
+   */
+  inline void skipRight (int skip) {
+    STRIP_SCANNER_DISPATCH (move, (skip, false)) }
+
+  /**
+   * \brief Appends next scans on the left to a scan strip.
+   * Gets up to the given count of scans, but stops as soon as a scan is
+   *   found empty while the strip is still empty.
+   * Returns the new count of points in the strip, or 0 if the scans get
+   *   out of the scan area.
+   * @param strip Scan strip to be completed.
+   * @param count Count of scans to get.
+   */
+  inline int nextOnLeft (ScanStrip &strip, int count) {
+    STRIP_SCANNER_DISPATCH (return nextScans, (strip, count, true)) }
+
+  /**
+   * \brief Appends next scans on the right to a scan strip.
+   * Gets up to the given count of scans, but stops as soon as a scan is
+   *   found empty while the strip is still empty.
+   * Returns the new count of points in the strip, or 0 if the scans get
+   *   out of the scan area.
+   * @param strip Scan strip to be completed.
+   * @param count Count of scans to get.
+   */
+  inline int nextOnRight (ScanStrip &strip, int count) {
+    STRIP_SCANNER_DISPATCH (return nextScans, (strip, count, false)) }
+
+  /**
+   * \brief Binds the scan strip to wrap the given digital line.
+   * Resets bounding lines parameters to center the scan strip on given line.
+   * Has no effect on static scanners.
+   * @param a New value for the 'a' parameter of current scan strip.
+   * @param b New value for the 'b' parameter of current scan strip.
+   * @param c New value for the 'c' parameter of current scan strip.
+   */
+  inline void bindTo (int a, int b, int c) {
+    STRIP_SCANNER_DISPATCH (bindTo, (a, b, c)) }
+
+  /**
+   * \brief Returns the scanner coordinates of given point.
+   * Scanner coordinates are the scan index and the position in the scan.
+   * Only available for static scanners, given point is returned otherwise.
+   * @param pt Image coordinates of the point.
+   */
+  Pt2i locate (const Pt2i &pt) const;
+
+  /**
+   * \brief Releases clearance status of output vector before filling.
+   */
+  inline void releaseClearance () { clearance = false; }
+
+  /**
+   * \brief Returns the scan strip octant (1, 2, 7 or 8).
+   */
+  inline int octant () const { return (OCTANTS[kind / 3]); }
+
+  /**
+   * \brief Returns the scan modality (STATIC, ADAPTIVE or ORTHO).
+   */
+  inline int mode () const { return (kind % 3); }
+
+
+private:
+
+  /** Octant numbers, in selector order. */
+  static const int OCTANTS[4];
+
+  /** Octant and modality selector : 3 * octant index + modality. */
+  int kind;
+  /** Scanable area left border. */
+  int xmin;
+  /** Scanable area bottom border. */
+  int ymin;
+  /** Scanable area right border. */
+  int xmax;
+  /** Scanable area top border. */
+  int ymax;
+  /** Parameter 'a' of the upper support discrete line. */
+  int dla;
+  /** Parameter 'b' of the upper support discrete line. */
+  int dlb;
+  /** Parameter 'c' of the lower support (control) line. */
+  int dlc1;
+  /** Parameter 'c' of the upper support discrete line. */
+  int dlc2;
+  /** Parameter 'a' of the template support line (adaptive modalities). */
+  int templ_a;
+  /** Parameter 'b' of the template support line (adaptive modalities). */
+  int templ_b;
+  /** Thickness of the template scan strip (adaptive modalities). */
+  int templ_nu;
+  /** Size of the discrete line pattern. */
+  int nbs;
+  /** Discrete line pattern. */
+  const bool *steps;
+  /** Pattern ownership : shared patterns are not copied nor deleted. */
+  bool owned;
+  /** Pointer to the end of discrete line pattern. */
+  const bool *fs;
+  /** X-start position of central scan (used in locate (Pt2i)). */
+  int ccx;
+  /** Y-start position of central scan (used in locate (Pt2i)). */
+  int ccy;
+  /** X-start position of last scan to the left. */
+  int lcx;
+  /** Y-start position of last scan to the left. */
+  int lcy;
+  /** X-start position of last scan to the right. */
+  int rcx;
+  /** Y-start position of last scan to the right. */
+  int rcy;
+  /** Current pattern step in strip direction on the left. */
+  const bool *lst1;
+  /** Current pattern step in strip direction on the right. */
+  const bool *rst1;
+  /** Current pattern step in scan line direction for left scans. */
+  const bool *lst2;
+  /** Current pattern step in scan line direction for right scans. */
+  const bool *rst2;
+  /** Flag indicating a pattern stop on the left side. */
+  bool lstop;
+  /** Flag indicating a pattern stop on the right side. */
+  bool rstop;
+  /** Flag indicating if the output vector should be cleared before filling.
+      Set to true by default. */
+  bool clearance;
+
+
+  /**
+   * \brief Copies the state of given scanner.
+   * An owned pattern is duplicated, a shared one is shared.
+   * @param ds Source directional scanner.
+   */
+  void copy (const StripScanner &ds);
+
+  /**
+   * \brief Sets the central scan start from its center and length.
+   * @param length Length of the central scan.
+   */
+  template <int OCT, int MODE> void center (int length);
+
+  /**
+   * \brief Checks whether given point lies between the support lines.
+   * Only the upper support line is tested : the scans start on the lower one.
+   * @param x Point X-coordinate.
+   * @param y Point Y-coordinate.
+   */
+  template <int OCT> inline bool inStrip (int x, int y) const
+  {
+    return (ScanOctant<OCT>::GE ? dla * x + dlb * y >= dlc2
+                                : dla * x + dlb * y <= dlc2);
+  }
+
+  /**
+   * \brief Checks whether a scan at given point has not yet entered the area.
+   * Vertical / horizontal scans are only checked along their direction.
+   * @param x Point X-coordinate.
+   * @param y Point Y-coordinate.
+   */
+  template <int OCT, int MODE> inline bool beforeArea (int x, int y) const
+  {
+    typedef ScanOctant<OCT> O;
+    const int dx = O::MX + (MODE == ORTHO ? 0 : O::SX);
+    const int dy = O::MY + (MODE == ORTHO ? 0 : O::SY);
+    return ((dx > 0 && x < xmin) || (dx < 0 && x >= xmax)
+            || (dy > 0 && y < ymin) || (dy < 0 && y >= ymax));
+  }
+
+  /**
+   * \brief Checks whether a scan at given point has not yet left the area.
+   * Vertical / horizontal scans are only checked along their direction.
+   * @param x Point X-coordinate.
+   * @param y Point Y-coordinate.
+   */
+  template <int OCT, int MODE> inline bool inArea (int x, int y) const
+  {
+    typedef ScanOctant<OCT> O;
+    const int dx = O::MX + (MODE == ORTHO ? 0 : O::SX);
+    const int dy = O::MY + (MODE == ORTHO ? 0 : O::SY);
+    return ((dx > 0 ? x < xmax : (dx == 0 || x >= xmin))
+            && (dy > 0 ? y < ymax : (dy == 0 || y >= ymin)));
+  }
+
+  /**
+   * \brief Checks whether a scan start on one side has left the area.
+   * @param x Scan start X-coordinate.
+   * @param y Scan start Y-coordinate.
+   */
+  template <int OCT, bool LEFT> inline bool beyondArea (int x, int y) const
+  {
+    typedef ScanOctant<OCT> O;
+    const int ux = (LEFT == (bool) O::LEFT_A ? - O::SX : O::SX);
+    const int uy = (LEFT == (bool) O::LEFT_A ? - O::SY : O::SY);
+    return ((ux > 0 && x >= xmax) || (ux < 0 && x < xmin)
+            || (uy > 0 && y >= ymax) || (uy < 0 && y < ymin));
+  }
+
+  /**
+   * \brief Moves one point forwards along a scan.
+   * @param x Point X-coordinate.
+   * @param y Point Y-coordinate.
+   * @param nst Current pattern step.
+   */
+  template <int OCT, int MODE>
+  inline void forth (int &x, int &y, const bool *&nst) const
+  {
+    typedef ScanOctant<OCT> O;
+    if (MODE != ORTHO)
+    {
+      if (*nst) { x += O::SX; y += O::SY; }
+      if (++nst >= fs) nst = steps;
+    }
+    x += O::MX;
+    y += O::MY;
+  }
+
+  /**
+   * \brief Adds the points of a scan to given vector.
+   * Returns the new size of the vector.
+   * Vertical / horizontal scans lying out of the area are left empty.
+   * @param scan Vector of points to be completed.
+   * @param x Scan start X-coordinate.
+   * @param y Scan start Y-coordinate.
+   * @param nst Scan start pattern step.
+   */
+  template <int OCT, int MODE>
+  inline int fill (std::vector<Pt2i> &scan,
+                   int x, int y, const bool *nst) const
+  {
+    if (MODE == ORTHO && (ScanOctant<OCT>::SX != 0 ? x < xmin || x >= xmax
+                                                   : y < ymin || y >= ymax))
+      return ((int) (scan.size ()));
+    while (beforeArea<OCT,MODE> (x, y) && inStrip<OCT> (x, y))
+      forth<OCT,MODE> (x, y, nst);
+    while (inStrip<OCT> (x, y) && inArea<OCT,MODE> (x, y))
+    {
+      scan.push_back (Pt2i (x, y));
+      forth<OCT,MODE> (x, y, nst);
+    }
+    return ((int) (scan.size ()));
+  }
+
+  /**
+   * \brief Adds the points of a scan to given scan strip and closes it.
+   * Returns the new size of the strip.
+   * @param strip Scan strip to be completed.
+   * @param x Scan start X-coordinate.
+   * @param y Scan start Y-coordinate.
+   * @param nst Scan start pattern step.
+   */
+  template <int OCT, int MODE>
+  inline int fill (ScanStrip &strip, int x, int y, const bool *nst) const
+  {
+    if (MODE != ORTHO || (ScanOctant<OCT>::SX != 0 ? x >= xmin && x < xmax
+                                                   : y >= ymin && y < ymax))
+    {
+      while (beforeArea<OCT,MODE> (x, y) && inStrip<OCT> (x, y))
+        forth<OCT,MODE> (x, y, nst);
+      while (inStrip<OCT> (x, y) && inArea<OCT,MODE> (x, y))
+      {
+        strip.add (x, y);
+        forth<OCT,MODE> (x, y, nst);
+      }
+    }
+    strip.closeScan ();
+    return (strip.size ());
+  }
+
+  /**
+   * \brief Moves a static scan start to the next scan on one side.
+   * On the side reached by a move opposite to the secondary direction,
+   *   the scan start follows the pattern in strip direction and sets the
+   *   stop flag when a scan line step is met. On the other side, the
+   *   scan start moves back along the scan when the strip pattern steps.
+   * @param x Scan start X-coordinate.
+   * @param y Scan start Y-coordinate.
+   * @param st1 Current pattern step in strip direction.
+   * @param st2 Current pattern step in scan direction.
+   * @param stop Pattern stop flag.
+   */
+  template <int OCT, bool LEFT>
+  inline void step (int &x, int &y, const bool *&st1, const bool *&st2, bool &stop) const
+  {
+    typedef ScanOctant<OCT> O;
+    if (LEFT == (bool) O::LEFT_A)
+    {
+      if (stop)
+      {
+        x -= O::SX;
+        y -= O::SY;
+        stop = false;
+      }
+      else
+      {
+        if (LEFT && --st1 < steps) st1 = fs - 1;
+        x -= O::SX;
+        y -= O::SY;
+        if (*st1)
+        {
+          x += O::MX;
+          y += O::MY;
+          if (*st2)
+          {
+            x += O::SX;
+            y += O::SY;
+            stop = true;
+          }
+          if (++st2 >= fs) st2 = steps;
+        }
+        if ((! LEFT) && ++st1 >= fs) st1 = steps;
+      }
+    }
+    else
+    {
+      if (stop)
+      {
+        x -= O::MX;
+        y -= O::MY;
+        if (--st2 < steps) st2 = fs - 1;
+        stop = false;
+      }
+      else
+      {
+        if (LEFT && --st1 < steps) st1 = fs - 1;
+        x += O::SX;
+        y += O::SY;
+        if (*st1)
+        {
+          if (--st2 < steps) st2 = fs - 1;
+          if (*st2)
+          {
+            if (++st2 >= fs) st2 = steps;
+            stop = true;
+          }
+          else
+          {
+            x -= O::MX;
+            y -= O::MY;
+          }
+        }
+        if ((! LEFT) && ++st1 >= fs) st1 = steps;
+      }
+    }
+  }
+
+  /**
+   * \brief Moves an adaptive scan start back onto the control line.
+   * @param x Scan start X-coordinate.
+   * @param y Scan start Y-coordinate.
+   * @param st2 Current pattern step in scan direction.
+   */
+  template <int OCT, int MODE>
+  inline void follow (int &x, int &y, const bool *&st2) const
+  {
+    typedef ScanOctant<OCT> O;
+    // Whenever the control line changed
+    while ((O::MX > 0 ? x < xmax - 1 : O::MX < 0 ? x > xmin : true)
+           && (O::MY > 0 ? y < ymax - 1 : O::MY < 0 ? y > ymin : true)
+           && (MODE == ORTHO
+               || ((O::SX > 0 ? x < xmax : O::SX < 0 ? x >= xmin : true)
+                   && (O::SY > 0 ? y < ymax : O::SY < 0 ? y >= ymin : true)))
+           && (O::GE ? dla * x + dlb * y > dlc1 : dla * x + dlb * y < dlc1))
+    {
+      if (MODE != ORTHO)
+      {
+        if (*st2) { x += O::SX; y += O::SY; }
+        if (++st2 >= fs) st2 = steps;
+      }
+      x += O::MX;
+      y += O::MY;
+    }
+    while ((O::MX < 0 ? x < xmax - 1 : O::MX > 0 ? x > xmin : true)
+           && (O::MY < 0 ? y < ymax - 1 : O::MY > 0 ? y > ymin : true)
+           && (MODE == ORTHO
+               || ((O::SX < 0 ? x < xmax : O::SX > 0 ? x >= xmin : true)
+                   && (O::SY < 0 ? y < ymax : O::SY > 0 ? y >= ymin : true)))
+           && (O::GE ? dla * x + dlb * y < dlc1 : dla * x + dlb * y > dlc1))
+    {
+      if (MODE != ORTHO)
+      {
+        if (--st2 < steps) st2 = fs - 1;
+        if (*st2) { x -= O::SX; y -= O::SY; }
+      }
+      x -= O::MX;
+      y -= O::MY;
+    }
+  }
+
+  /**
+   * \brief Moves a scan start by some scans on one side.
+   * @param x Scan start X-coordinate.
+   * @param y Scan start Y-coordinate.
+   * @param st1 Current pattern step in strip direction.
+   * @param st2 Current pattern step in scan direction.
+   * @param stop Pattern stop flag.
+   * @param skip Count of scans to move through.
+   */
+  template <int OCT, int MODE, bool LEFT>
+  inline void shift (int &x, int &y, const bool *&st1, const bool *&st2, bool &stop,
+                     int skip) const
+  {
+    typedef ScanOctant<OCT> O;
+    if (MODE == STATIC)
+      while (skip-- != 0) step<OCT,LEFT> (x, y, st1, st2, stop);
+    else
+    {
+      // Left scans are reached opposite to the secondary direction
+      //   in case of LEFT_A octants
+      int u = ((LEFT == (bool) O::LEFT_A) ? - skip : skip);
+      x += u * O::SX;
+      y += u * O::SY;
+    }
+  }
+
+  /**
+   * \brief Gets a scan to the left after some skipped ones in a vector.
+   * Adds points of the scan to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   * @param skip Skip length.
+   */
+  template <int OCT, int MODE>
+  inline int skipLeft (std::vector<Pt2i> &scan, int skip)
+  {
+    if (clearance) scan.clear ();
+    shift<OCT,MODE,true> (lcx, lcy, lst1, lst2, lstop, skip);
+    if (MODE == ORTHO && beyondArea<OCT,true> (lcx, lcy)) return 0;
+    if (MODE != STATIC) follow<OCT,MODE> (lcx, lcy, lst2);
+    return (fill<OCT,MODE> (scan, lcx, lcy, lst2));
+  }
+
+  /**
+   * \brief Gets a scan to the right after some skipped ones in a vector.
+   * Adds points of the scan to given vector and returns its new size.
+   * @param scan Vector of points to be completed.
+   * @param skip Skip length.
+   */
+  template <int OCT, int MODE>
+  inline int skipRight (std::vector<Pt2i> &scan, int skip)
+  {
+    if (clearance) scan.clear ();
+    shift<OCT,MODE,false> (rcx, rcy, rst1, rst2, rstop, skip);
+    if (MODE == ORTHO && beyondArea<OCT,false> (rcx, rcy)) return 0;
+    if (MODE != STATIC) follow<OCT,MODE> (rcx, rcy, rst2);
+    return (fill<OCT,MODE> (scan, rcx, rcy, rst2));
+  }
+
+  /**
+   * \brief Appends next scans on one side to a scan strip.
+   * Returns the new size of the strip, or 0 when leaving the scan area.
+   * @param strip Scan strip to be completed.
+   * @param count Count of scans to get.
+   * @param left Side of the scans.
+   */
+  template <int OCT, int MODE>
+  inline int nextScans (ScanStrip &strip, int count, bool left)
+  {
+    int nbp = strip.size ();
+    while (count-- != 0)
+    {
+      if (left)
+      {
+        shift<OCT,MODE,true> (lcx, lcy, lst1, lst2, lstop, 1);
+        if (MODE == ORTHO && beyondArea<OCT,true> (lcx, lcy)) return 0;
+        if (MODE != STATIC) follow<OCT,MODE> (lcx, lcy, lst2);
+        nbp = fill<OCT,MODE> (strip, lcx, lcy, lst2);
+      }
+      else
+      {
+        shift<OCT,MODE,false> (rcx, rcy, rst1, rst2, rstop, 1);
+        if (MODE == ORTHO && beyondArea<OCT,false> (rcx, rcy)) return 0;
+        if (MODE != STATIC) follow<OCT,MODE> (rcx, rcy, rst2);
+        nbp = fill<OCT,MODE> (strip, rcx, rcy, rst2);
+      }
+      if (nbp == 0) break;
+    }
+    return (nbp);
+  }
+
+  /**
+   * \brief Skips scans on one side.
+   * @param skip Skip length.
+   * @param left Side of the skipped scans.
+   */
+  template <int OCT, int MODE>
+  inline void move (int skip, bool left)
+  {
+    if (MODE == STATIC)
+    {
+      if (left)
+        while (--skip != 0) step<OCT,true> (lcx, lcy, lst1, lst2, lstop);
+      else
+        while (--skip != 0) step<OCT,false> (rcx, rcy, rst1, rst2, rstop);
+    }
+    else
+    {
+      if (left) shift<OCT,MODE,true> (lcx, lcy, lst1, lst2, lstop, skip - 1);
+      else shift<OCT,MODE,false> (rcx, rcy, rst1, rst2, rstop, skip - 1);
+    }
+  }
+
+  /**
+   * \brief Binds the scan strip to wrap the given digital line.
+   * @param a New value for the 'a' parameter of current scan strip.
+   * @param b New value for the 'b' parameter of current scan strip.
+   * @param c New value for the 'c' parameter of current scan strip.
+   */
+  template <int OCT, int MODE> inline void bindTo (int a, int b, int c)
+  {
+    if (MODE == STATIC) return;
+    if (a < 0)
+    {
+      dla = -a;
+      dlb = -b;
+      c = -c;
+    }
+    else
+    {
+      dla = a;
+      dlb = b;
+    }
+    int old_b = (templ_b < 0 ? -templ_b : templ_b);
+    int old_n1 = templ_a + old_b;
+    int old_ninf = (old_b > templ_a ? old_b : templ_a);
+    int new_a = (a < 0 ? -a : a);
+    int new_b = (b < 0 ? -b : b);
+    int new_n1 = new_a + new_b;
+    int new_ninf = (new_b > new_a ? new_b : new_a);
+    int nu;
+    if (new_n1 * old_ninf > old_n1 * new_ninf)
+      nu = (templ_nu * new_n1) / old_n1;
+    else
+      nu = (templ_nu * new_ninf) / old_ninf;
+    if (ScanOctant<OCT>::KEEP_B * dlb < 0)
+    {
+      dla = -dla;
+      dlb = -dlb;
+      c = -c;
+    }
+    if (ScanOctant<OCT>::GE)
+    {
+      dlc1 = c + nu / 2;
+      dlc2 = c - nu / 2;
+    }
+    else
+    {
+      dlc1 = c - nu / 2;
+      dlc2 = c + nu / 2;
+    }
+  }
+
+  /**
+   * \brief Returns the scanner coordinates of given point.
+   * @param pt Image coordinates of the point.
+   */
+  template <int OCT> Pt2i locate (const Pt2i &pt) const;
+};
+
+#undef STRIP_SCANNER_DISPATCH
+
+#endif
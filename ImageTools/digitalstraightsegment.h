@@ -89,6 +89,31 @@ public:
     a = dss.a; b = dss.b; c = dss.c; nu = dss.nu;
     min = dss.min; max = dss.max; }
 
+  /**
+   * \brief Sets the segment parameter values.
+   * @param va Slope X coordinate.
+   * @param vb Slope Y coordinate.
+   * @param vc Shift to origin.
+   * @param vnu Arithmetical width.
+   * @param vmin Bounding line lower coordinate.
+   * @param vmax Bounding line upper coordinate.
+   */
+  inline void set (int va, int vb, int vc, int vnu, int vmin, int vmax) {
+    a = va; b = vb; c = vc; nu = vnu; min = vmin; max = vmax; }
+
+  /**
+   * \brief Returns the segment parameter values.
+   * @param va Slope X coordinate to provide.
+   * @param vb Slope Y coordinate to provide.
+   * @param vc Shift to origin to provide.
+   * @param vnu Arithmetical width to provide.
+   * @param vmin Bounding line lower coordinate to provide.
+   * @param vmax Bounding line upper coordinate to provide.
+   */
+  inline void parameters (int &va, int &vb, int &vc, int &vnu,
+                          int &vmin, int &vmax) const {
+    va = a; vb = b; vc = c; vnu = nu; vmin = min; vmax = max; }
+
   /**
    * \brief Creates a digital straight segment from another one.
    * @param dss Pointer to the digital straight segment to copy.
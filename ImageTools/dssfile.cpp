@@ -0,0 +1,224 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <cstring>
+#include "dssfile.h"
+
+
+const char DssWriter::TAG[4] = { 'D', 'S', 'S', 'F' };
+const int DssWriter::VERSION = 1;
+const int DssWriter::COMPACT_FLAG = 1;
+const int DssWriter::HEADER_SIZE = 24;
+const int DssWriter::COUNT_POS = 20;
+const int DssWriter::MAX_SEGMENT_SIZE = 30;
+
+
+
+DssWriter::DssWriter ()
+{
+  compact = true;
+  count = 0;
+  last_min = 0;
+}
+
+
+bool DssWriter::open (const std::string &name,
+                      int width, int height, float csize, bool compact)
+{
+  out.open (name.c_str (), std::ios::out | std::ios::binary);
+  if (! out.is_open ()) return false;
+  this->compact = compact;
+  count = 0;
+  last_min = 0;
+  unsigned int fcs;
+  memcpy (&fcs, &csize, sizeof (float));
+  char head[HEADER_SIZE];
+  memcpy (head, TAG, 4);
+  head[4] = (char) VERSION;
+  head[5] = (char) (compact ? COMPACT_FLAG : 0);
+  head[6] = 0;
+  head[7] = 0;
+  char *pos = putInt (head + 8, width);
+  pos = putInt (pos, height);
+  pos = putInt (pos, (int) fcs);
+  putInt (pos, -1);
+  out.write (head, HEADER_SIZE);
+  return true;
+}
+
+
+void DssWriter::write (const DigitalStraightSegment &ds)
+{
+  int a, b, c, nu, min, max;
+  ds.parameters (a, b, c, nu, min, max);
+  char buf[MAX_SEGMENT_SIZE];
+  char *pos = buf;
+  if (compact)
+  {
+    pos = putVarint (pos, a);
+    pos = putVarint (pos, b);
+    pos = putVarint (pos, c);
+    pos = putVarint (pos, nu);
+    pos = putVarint (pos, min - last_min);
+    pos = putVarint (pos, max - min);
+    last_min = min;
+  }
+  else
+  {
+    pos = putInt (pos, a);
+    pos = putInt (pos, b);
+    pos = putInt (pos, c);
+    pos = putInt (pos, nu);
+    pos = putInt (pos, min);
+    pos = putInt (pos, max);
+  }
+  out.write (buf, pos - buf);
+  count ++;
+}
+
+
+char *DssWriter::putInt (char *buf, int val)
+{
+  unsigned int v = (unsigned int) val;
+  *buf++ = (char) (v & 0xff);
+  *buf++ = (char) ((v >> 8) & 0xff);
+  *buf++ = (char) ((v >> 16) & 0xff);
+  *buf++ = (char) ((v >> 24) & 0xff);
+  return buf;
+}
+
+
+char *DssWriter::putVarint (char *buf, int val)
+{
+  unsigned int v = (((unsigned int) val) << 1) ^ (unsigned int) (val >> 31);
+  while (v >= 0x80)
+  {
+    *buf++ = (char) ((v & 0x7f) | 0x80);
+    v >>= 7;
+  }
+  *buf++ = (char) v;
+  return buf;
+}
+
+
+bool DssWriter::close ()
+{
+  bool ok = out.good ();
+  if (ok && out.seekp (COUNT_POS))
+  {
+    char buf[4];
+    putInt (buf, count);
+    out.write (buf, 4);
+    ok = out.good ();
+  }
+  out.close ();
+  return ok;
+}
+
+
+
+DssReader::DssReader ()
+{
+  compact = true;
+  w = 0;
+  h = 0;
+  cs = 0.0f;
+  count = 0;
+  nbread = 0;
+  last_min = 0;
+}
+
+
+bool DssReader::open (const std::string &name)
+{
+  in.open (name.c_str (), std::ios::in | std::ios::binary);
+  if (! in.is_open ()) return false;
+  char head[8];
+  in.read (head, 8);
+  int fcs = 0;
+  if ((! in) || memcmp (head, DssWriter::TAG, 4) != 0
+      || head[4] != DssWriter::VERSION
+      || ! (getInt (w) && getInt (h) && getInt (fcs) && getInt (count)))
+  {
+    in.close ();
+    return false;
+  }
+  compact = ((head[5] & DssWriter::COMPACT_FLAG) != 0);
+  memcpy (&cs, &fcs, sizeof (float));
+  nbread = 0;
+  last_min = 0;
+  return true;
+}
+
+
+bool DssReader::read (DigitalStraightSegment &ds)
+{
+  if (nbread == count) return false;
+  int a, b, c, nu, min, max;
+  if (compact)
+  {
+    if (! (getVarint (a) && getVarint (b) && getVarint (c) && getVarint (nu)
+           && getVarint (min) && getVarint (max))) return false;
+    min += last_min;
+    max += min;
+    last_min = min;
+  }
+  else if (! (getInt (a) && getInt (b) && getInt (c) && getInt (nu)
+              && getInt (min) && getInt (max))) return false;
+  ds.set (a, b, c, nu, min, max);
+  nbread ++;
+  return true;
+}
+
+
+bool DssReader::close ()
+{
+  in.close ();
+  return (count == -1 || nbread == count);
+}
+
+
+bool DssReader::getInt (int &val)
+{
+  unsigned char buf[4];
+  if (! in.read ((char *) buf, 4)) return false;
+  val = (int) (buf[0] | (buf[1] << 8) | (buf[2] << 16)
+               | (((unsigned int) buf[3]) << 24));
+  return true;
+}
+
+
+bool DssReader::getVarint (int &val)
+{
+  unsigned int v = 0;
+  for (int shift = 0; shift < 35; shift += 7)
+  {
+    int byte = in.get ();
+    if (byte == EOF) return false;
+    v |= ((unsigned int) (byte & 0x7f)) << shift;
+    if ((byte & 0x80) == 0)
+    {
+      val = (int) (v >> 1) ^ - (int) (v & 1);
+      return true;
+    }
+  }
+  return false;
+}
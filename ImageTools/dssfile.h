@@ -0,0 +1,210 @@
+/*  Copyright 2021 Philippe Even and Phuc Ngo,
+      authors of paper:
+      Even, P., and Ngo, P., 2021,
+      Automatic forest road extraction fromLiDAR data of mountainous areas.
+      In the First International Joint Conference of Discrete Geometry
+      and Mathematical Morphology (Springer LNCS 12708), pp. 93-106.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef DSS_FILE_H
+#define DSS_FILE_H
+
+#include <fstream>
+#include <string>
+#include "digitalstraightsegment.h"
+
+
+/** 
+ * @class DssWriter dssfile.h
+ * \brief Sequential writer of digital straight segment files.
+ * The file starts with a 24 bytes header : a 4 chars tag, the format
+ *   version, an encoding flag, two spare bytes, then the map width and
+ *   height, the cell size and the count of segments.
+ * All the values are little-endian, independently of the host machine.
+ * Each segment is then stored by its six integral parameters (a, b, c, nu,
+ *   min, max), either as plain 32 bits integers, or in compact encoding as
+ *   zigzag varints, with min given as a shift to previous segment min and
+ *   max as a shift to min.
+ * The count of segments is updated when the file is closed. It is left to
+ *   -1 (read until end of file) on non seekable outputs.
+ */
+class DssWriter
+{
+public:
+
+  /** File format tag. */
+  static const char TAG[4];
+  /** File format version. */
+  static const int VERSION;
+  /** Header flag for compact encoding. */
+  static const int COMPACT_FLAG;
+
+  /**
+   * \brief Creates a digital straight segment file writer.
+   */
+  DssWriter ();
+
+  /**
+   * \brief Opens a segment file and writes its header.
+   * Returns whether the file could be opened.
+   * @param name File name.
+   * @param width Map width.
+   * @param height Map height.
+   * @param csize Map cell size.
+   * @param compact Varint compact encoding modality.
+   */
+  bool open (const std::string &name,
+             int width, int height, float csize, bool compact = true);
+
+  /**
+   * \brief Appends a digital straight segment to the file.
+   * @param ds Digital straight segment to write.
+   */
+  void write (const DigitalStraightSegment &ds);
+
+  /**
+   * \brief Sets the count of segments in the header and closes the file.
+   * Returns whether the file was successfully written.
+   */
+  bool close ();
+
+
+private:
+
+  /** Size of the file header. */
+  static const int HEADER_SIZE;
+  /** Position of the count of segments in the header. */
+  static const int COUNT_POS;
+  /** Maximal size of an encoded segment. */
+  static const int MAX_SEGMENT_SIZE;
+
+  /** Output file. */
+  std::ofstream out;
+  /** Varint compact encoding modality. */
+  bool compact;
+  /** Count of written segments. */
+  int count;
+  /** Lower bound of last written segment. */
+  int last_min;
+
+  /**
+   * \brief Stores a little-endian 32 bits integer in a buffer.
+   * Returns the next buffer position.
+   * @param buf Buffer position.
+   * @param val Integer to store.
+   */
+  static char *putInt (char *buf, int val);
+
+  /**
+   * \brief Stores a zigzag encoded varint in a buffer.
+   * Returns the next buffer position.
+   * @param buf Buffer position.
+   * @param val Integer to store.
+   */
+  static char *putVarint (char *buf, int val);
+};
+
+
+/** 
+ * @class DssReader dssfile.h
+ * \brief Sequential reader of digital straight segment files.
+ * See DssWriter for the description of the file format.
+ */
+class DssReader
+{
+public:
+
+  /**
+   * \brief Creates a digital straight segment file reader.
+   */
+  DssReader ();
+
+  /**
+   * \brief Opens a segment file and reads its header.
+   * Returns whether the file could be opened with a known format.
+   * @param name File name.
+   */
+  bool open (const std::string &name);
+
+  /**
+   * \brief Returns the map width.
+   */
+  inline int width () const { return (w); }
+
+  /**
+   * \brief Returns the map height.
+   */
+  inline int height () const { return (h); }
+
+  /**
+   * \brief Returns the map cell size.
+   */
+  inline float cellSize () const { return (cs); }
+
+  /**
+   * \brief Returns the count of segments in the file (-1 if unknown).
+   */
+  inline int size () const { return (count); }
+
+  /**
+   * \brief Reads next digital straight segment.
+   * Returns false at the end of the file or on truncated data.
+   * @param ds Digital straight segment to set.
+   */
+  bool read (DigitalStraightSegment &ds);
+
+  /**
+   * \brief Closes the file.
+   * Returns whether all announced segments were read.
+   */
+  bool close ();
+
+
+private:
+
+  /** Input file. */
+  std::ifstream in;
+  /** Varint compact encoding modality. */
+  bool compact;
+  /** Map width. */
+  int w;
+  /** Map height. */
+  int h;
+  /** Map cell size. */
+  float cs;
+  /** Count of segments in the file, or -1 if unknown. */
+  int count;
+  /** Count of read segments. */
+  int nbread;
+  /** Lower bound of last read segment. */
+  int last_min;
+
+  /**
+   * \brief Reads a little-endian 32 bits integer.
+   * Returns false on end of file.
+   * @param val Integer to set.
+   */
+  bool getInt (int &val);
+
+  /**
+   * \brief Reads a zigzag encoded varint.
+   * Returns false on end of file or on a too long sequence.
+   * @param val Integer to set.
+   */
+  bool getVarint (int &val);
+};
+
+#endif
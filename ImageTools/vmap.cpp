@@ -35,6 +35,7 @@ const int VMap::DEFAULT_GRADIENT_RESOLUTION = 100;
 const int VMap::MAX_BOWL = 20;
 const int VMap::NB_DILATIONS = 5;
 const int VMap::DEFAULT_DILATION = 4;
+const int VMap::BOWL_RADIUS = 2;
 
 
 
@@ -131,6 +132,11 @@ VMap::~VMap ()
   delete [] mask;
   delete [] dilations;
   delete [] bowl;
+  delete [] spanLow;
+  delete [] spanHigh;
+  delete [] gnorm;
+  delete [] pondmin;
+  delete [] fired;
 }
 
 
@@ -139,9 +145,13 @@ void VMap::init ()
   gradientThreshold = DEFAULT_GRADIENT_THRESHOLD;
   gmagThreshold = gradientThreshold;
   gradres = DEFAULT_GRADIENT_RESOLUTION;
-  mask = new bool[width * height];
-  for (int i = 0; i < width * height; i++) mask[i] = false;
+  mwidth = (width + 31) / 32;
+  mask = new unsigned int[mwidth * height];
+  for (int i = 0; i < mwidth * height; i++) mask[i] = 0;
   masking = false;
+  gnorm = new int[getHeightWidthMax ()];
+  pondmin = new int[getHeightWidthMax ()];
+  fired = new bool[getHeightWidthMax ()];
   angleThreshold = NEAR_SQ_ANGLE;
   orientedGradient = true;
   bowl = new Vr2i[MAX_BOWL];
@@ -172,6 +182,33 @@ void VMap::init ()
   dilations[3] = 12;
   dilations[4] = 20;
   maskDilation = DEFAULT_DILATION;
+  buildDilationSpans ();
+}
+
+
+void VMap::buildDilationSpans ()
+{
+  int nbrows = 2 * BOWL_RADIUS + 1;
+  spanLow = new int[NB_DILATIONS * nbrows];
+  spanHigh = new int[NB_DILATIONS * nbrows];
+  for (int d = 0; d < NB_DILATIONS; d++)
+  {
+    int *low = spanLow + d * nbrows;
+    int *high = spanHigh + d * nbrows;
+    for (int r = 0; r < nbrows; r++)
+    {
+      low[r] = 1;  // empty row
+      high[r] = 0;
+    }
+    low[BOWL_RADIUS] = 0;  // bowl center
+    for (int i = 0; i < dilations[d]; i++)
+    {
+      int r = BOWL_RADIUS + bowl[i].y ();
+      if (low[r] > high[r]) low[r] = high[r] = bowl[i].x ();
+      else if (bowl[i].x () < low[r]) low[r] = bowl[i].x ();
+      else if (bowl[i].x () > high[r]) high[r] = bowl[i].x ();
+    }
+  }
 }
 
 
@@ -529,7 +566,7 @@ int VMap::keepFreeElementsIn (const std::vector<Pt2i> &pix,
   int i = 0;
   while (i < n)
   {
-    if (mask[pix[ind[i]].y () * width + pix[ind[i]].x ()]) ind[i] = ind[--n];
+    if (isMasked (pix[ind[i]].x (), pix[ind[i]].y ())) ind[i] = ind[--n];
     else i++;
   }
   return (n);
@@ -539,8 +576,7 @@ int VMap::keepFreeElementsIn (const std::vector<Pt2i> &pix,
 int VMap::keepContrastedMax (int *lmax, int n, int *in) const
 {
   if (n == 0) return 0;
-  int *min = new int[n-1];
-  bool *fired = new bool[n];
+  int *min = pondmin;
   int nbfired = 0;
   int sleft = 0;
 
@@ -633,7 +669,7 @@ int VMap::localMax (int *lmax, const std::vector<Pt2i> &pix) const
 {
   // Builds the gradient norm signal
   int n = (int) pix.size ();
-  int *gn = new int[n];
+  int *gn = gnorm;
   int i = 0;
   std::vector<Pt2i>::const_iterator it = pix.begin ();
   while (it != pix.end ()) gn[i++] = magn (*it++);
@@ -649,8 +685,6 @@ int VMap::localMax (int *lmax, const std::vector<Pt2i> &pix) const
 
   // Sorts candidates by gradient magnitude
   sortMax (lmax, count, gn);
-
-  delete [] gn;
   return count;
 }
 
@@ -660,7 +694,7 @@ int VMap::localMax (int *lmax, const std::vector<Pt2i> &pix,
 {
   // Builds the gradient norm signal
   int n = (int) pix.size ();
-  int *gn = new int[n];
+  int *gn = gnorm;
   int i = 0;
   std::vector<Pt2i>::const_iterator it = pix.begin ();
   while (it != pix.end ()) gn[i++] = magn (*it++);
@@ -681,8 +715,6 @@ int VMap::localMax (int *lmax, const std::vector<Pt2i> &pix,
 
   // Sorts candidates by gradient magnitude
   sortMax (lmax, count, gn);
-
-  delete [] gn;
   return count;
 }
 
@@ -768,23 +800,52 @@ void VMap::sortMax (int *lmax, int n, int *val) const
 
 void VMap::clearMask ()
 {
-  for (int i = 0; i < width * height; i++) mask[i] = false;
+  for (int i = 0; i < mwidth * height; i++) mask[i] = 0;
 }
 
 
 void VMap::setMask (const std::vector<Pt2i> &pts)
 {
-  std::vector<Pt2i>::const_iterator it = pts.begin ();
-  while (it != pts.end ())
-  {
-    Pt2i pt = *it++;
-    mask[pt.y () * width + pt.x ()] = true;
-    for (int i = 0; i < dilations[maskDilation]; i++)
+  setMask (pts.data (), (int) (pts.size ()));
+}
+
+
+void VMap::setMask (const Pt2i *pts, int nb)
+{
+  // Each dilated point is set as a stack of horizontal spans
+  int nbrows = 2 * BOWL_RADIUS + 1;
+  const int *low = spanLow + maskDilation * nbrows;
+  const int *high = spanHigh + maskDilation * nbrows;
+  const Pt2i *it = pts;
+  while (it != pts + nb)
+  {
+    int x = it->x (), y = it->y () - BOWL_RADIUS;
+    for (int r = 0; r < nbrows; r++, y++)
     {
-      int x = pt.x () + bowl[i].x ();
-      int y = pt.y () + bowl[i].y ();
-      if (x >= 0 && x < width && y >= 0 && y < height)
-        mask[y * width + x] = true;
+      if (low[r] <= high[r] && y >= 0 && y < height)
+      {
+        int x1 = x + low[r], x2 = x + high[r];
+        if (x1 < 0) x1 = 0;
+        if (x2 >= width) x2 = width - 1;
+        if (x1 <= x2) setMaskSpan (y, x1, x2);
+      }
     }
+    it++;
+  }
+}
+
+
+void VMap::setMaskSpan (int y, int x1, int x2)
+{
+  unsigned int *row = mask + y * mwidth;
+  int w1 = x1 >> 5, w2 = x2 >> 5;
+  unsigned int m1 = ~0u << (x1 & 31);
+  unsigned int m2 = ~0u >> (31 - (x2 & 31));
+  if (w1 == w2) row[w1] |= m1 & m2;
+  else
+  {
+    row[w1] |= m1;
+    for (int w = w1 + 1; w < w2; w++) row[w] = ~0u;
+    row[w2] |= m2;
   }
 }
@@ -207,6 +207,7 @@ public:
   /**
    * \brief Gets filtered and sorted local gradient maxima in a set of pixels.
    * Local max already used are pruned.
+   * Input set size should not exceed the largest map dimension.
    * Returns the count of found gradient maxima.
    * @param lmax Ouput local max index array.
    * @param pix Input set of pixels to process.
@@ -216,6 +217,7 @@ public:
   /**
    * \brief Gets filtered and sorted local oriented gradient maxima.
    * Local maxima are filtered according to the gradient direction and sorted.
+   * Input set size should not exceed the largest map dimension.
    * Returns the count of found gradient maxima.
    * @param lmax Local max index array.
    * @param pix Input set of pixels to process.
@@ -258,8 +260,14 @@ public:
 
   /**
    * \brief Returns the occupancy mask contents.
+   * The mask is a bitset stored row by row, each row starting on a new word.
    */
-  inline bool *getMask () const { return (mask); }
+  inline unsigned int *getMask () const { return (mask); }
+
+  /**
+   * \brief Returns the count of mask words per row.
+   */
+  inline int getMaskRowSize () const { return (mwidth); }
 
   /**
    * \brief Clears the occupancy mask.
@@ -272,6 +280,13 @@ public:
    */
   void setMask (const std::vector<Pt2i> &pts);
 
+  /**
+   * \brief Adds pixels to the occupancy mask.
+   * @param pts Array of pixels.
+   * @param nb Count of pixels in the array.
+   */
+  void setMask (const Pt2i *pts, int nb);
+
   /**
    * \brief Sets mask activation on or off.
    * @param status New activation status.
@@ -294,7 +309,7 @@ public:
    * @param pix Pixel to test in the mask.
    */
   inline bool isFree (const Pt2i &pix) const {
-    return (! mask[pix.y () * width + pix.x ()]); }
+    return (! isMasked (pix.x (), pix.y ())); }
 
 
 private:
@@ -311,6 +326,8 @@ private:
   static const int NB_DILATIONS;
   /** Default dilation for the points added to the mask. */
   static const int DEFAULT_DILATION;
+  /** Maximal coordinate shift in the dilation bowl. */
+  static const int BOWL_RADIUS;
 
   /** Image width. */
   int width;
@@ -334,8 +351,10 @@ private:
   /** Direction constraint status for local gradient maxima. */
   bool orientedGradient;
 
-  /** Occupancy mask. */
-  bool *mask;
+  /** Occupancy mask (bitset). */
+  unsigned int *mask;
+  /** Count of mask words per row. */
+  int mwidth;
   /** Flag indicating whether the occupancy mask is in use. */
   bool masking;
   /** Type of dilation applied to the points added to the mask. */
@@ -344,6 +363,38 @@ private:
   int *dilations;
   /** Dilation bowl. */
   Vr2i *bowl;
+  /** Dilation bowl lower X shift for each dilation type and each row. */
+  int *spanLow;
+  /** Dilation bowl upper X shift for each dilation type and each row. */
+  int *spanHigh;
+
+  /**
+   * \brief Tests the occupancy of a mask cell.
+   * @param x Cell column.
+   * @param y Cell row.
+   */
+  inline bool isMasked (int x, int y) const {
+    return ((mask[y * mwidth + (x >> 5)] >> (x & 31)) & 1); }
+
+  /**
+   * \brief Sets a horizontal span of mask cells.
+   * @param y Span row.
+   * @param x1 Span start column (included).
+   * @param x2 Span end column (included).
+   */
+  void setMaskSpan (int y, int x1, int x2);
+
+  /**
+   * \brief Builds the dilation bowl spans from the dilation bowl.
+   */
+  void buildDilationSpans ();
+
+  /** Gradient norm signal of the last scan (local max search buffer). */
+  int *gnorm;
+  /** Pond minimal values (local max filtering buffer). */
+  int *pondmin;
+  /** Fired local max flags (local max filtering buffer). */
+  bool *fired;
 
 
   /** 
@@ -363,6 +363,72 @@ bool IPtTileSet::collectPoints (std::vector<Pt3f> &pts, int i, int j) // const
 }
 
 
+int IPtTileSet::collectProjectedPoints (std::vector<Pt2f> &pts,
+                                const int *xs, const int *ys, int nb,
+                                const Pt2f &org, const Vr2f &dir,
+                                float len) const
+{
+  int nbout = 0;
+  int ktile = -1;
+  IPtTile *tile = NULL;
+  int xoff = 0, yoff = 0;
+  for (int p = 0; p < nb; p++)
+  {
+    int i = xs[p], j = ys[p];
+    int icell = i / cdiv, jcell = j / cdiv;                // cdiv = 10 when eco
+    int itile = icell / twidth, jtile = jcell / theight;
+    if (i < 0 || itile >= tcols || j < 0 || jtile >= trows)
+    {
+      nbout ++;
+      continue;
+    }
+    // Successive subcells mostly lie in the same tile
+    if (jtile * tcols + itile != ktile)
+    {
+      ktile = jtile * tcols + itile;
+      tile = tiles[ktile];
+      xoff = txspread * itile;
+      yoff = tyspread * jtile;
+    }
+    if (tile == NULL) continue;
+    if (tile->unloaded ())
+    {
+      nbout ++;
+      continue;
+    }
+    icell = icell - itile * tile->countOfColumns ();
+    jcell = jcell - jtile * tile->countOfRows ();
+    int nbpts = tile->cellSize (icell, jcell);
+    if (nbpts == 0) continue;
+    const Pt3i *pt = tile->cellStartPt (icell, jcell);
+    const Pt3i *ptfin = pt + nbpts;
+    if (cdiv != 1)
+    {
+      int cxy = tile->cellSize () / cdiv;
+      int cxmin = icell * tile->cellSize () + (i % cdiv) * cxy;
+      int cymin = jcell * tile->cellSize () + (j % cdiv) * cxy;
+      int cxmax = cxmin + cxy;
+      int cymax = cymin + cxy;
+      while (pt->y () < cymin && pt != ptfin) pt ++;
+      while (pt->x () < cxmin && pt != ptfin) pt ++;
+      const Pt3i *ptend = pt;
+      while (ptend->x () < cxmax && ptend->y () < cymax && ptend != ptfin)
+        ptend ++;
+      ptfin = ptend;
+    }
+    while (pt != ptfin)
+    {
+      float dx = ((float) (xoff + pt->x ())) * MM2M - org.x ();
+      float dy = ((float) (yoff + pt->y ())) * MM2M - org.y ();
+      pts.push_back (Pt2f ((dx * dir.x () + dy * dir.y ()) / len,
+                           ((float) pt->z ()) * MM2M));
+      pt ++;
+    }
+  }
+  return nbout;
+}
+
+
 bool IPtTileSet::collectPointsAndLabels (
                          std::vector<Pt3f> &pts, std::vector<int> &tls,
                          std::vector<int> &lbs, int i, int j) // const
@@ -532,6 +598,45 @@ void IPtTileSet::createBuffers ()
 }
 
 
+IPtTileSet *IPtTileSet::createColumnSubset (int imin, int imax) const
+{
+  if (imin < 0) imin = 0;
+  if (imax > tcols) imax = tcols;
+  IPtTileSet *sub = new IPtTileSet (buf_size);
+  sub->xmin = xmin;
+  sub->ymin = ymin;
+  sub->zmax = zmax;
+  sub->twidth = twidth;
+  sub->theight = theight;
+  sub->txspread = txspread;
+  sub->tyspread = tyspread;
+  sub->tcols = tcols;
+  sub->trows = trows;
+  sub->cdiv = cdiv;
+  sub->buf_np = buf_np;
+  sub->buf_ni = buf_ni;
+  sub->nb = 0;
+  sub->tiles = new IPtTile*[tcols * trows];
+  for (int j = 0; j < trows; j++)
+    for (int i = 0; i < tcols; i++)
+    {
+      int k = j * tcols + i;
+      sub->tiles[k] = NULL;
+      if (i >= imin && i < imax && tiles[k] != NULL)
+      {
+        IPtTile *tile = new IPtTile (tiles[k]->getName ());
+        if (tile->load (false))
+        {
+          sub->tiles[k] = tile;
+          sub->nb += tile->size ();
+        }
+        else delete tile;
+      }
+    }
+  return sub;
+}
+
+
 int IPtTileSet::nextTile ()
 {
   int k, bk;
@@ -24,6 +24,8 @@
 
 #include "ipttile.h"
 #include "pt3f.h"
+#include "pt2f.h"
+#include "vr2f.h"
 #include "pt2i.h"
 
 
@@ -244,6 +246,26 @@ public:
    */
   bool collectPoints (std::vector<Pt3f> &pts, int i, int j);// const;
 
+  /**
+   * \brief Pushes the points of a sequence of tile subcells in provided
+   *   vector, as their distance along a direction and their height.
+   *   Distance and height are computed from the tile points in meter unit,
+   *   as from collected points.
+   *   Tiles are assumed to be organized in sorted sub-cells.
+   * Returns the count of subcells out of loaded tiles.
+   * @param pts Provided vector of (distance, height) pairs.
+   * @param xs Array of tile subcell columns.
+   * @param ys Array of tile subcell rows.
+   * @param nb Count of tile subcells.
+   * @param org Distance origin point.
+   * @param dir Direction vector.
+   * @param len Direction vector length.
+   */
+  int collectProjectedPoints (std::vector<Pt2f> &pts,
+                              const int *xs, const int *ys, int nb,
+                              const Pt2f &org, const Vr2f &dir,
+                              float len) const;
+
   /**
    * \brief Pushes points and labels of given tile subcell in provided vectors.
    *   Points are transfered in meter unit.
@@ -306,6 +328,16 @@ public:
    */
   int nextTile ();
 
+  /**
+   * \brief Creates a tile set restricted to a range of tile columns.
+   * The new set keeps the tile array layout and coordinates, other tiles
+   *   being left empty. Its tiles are headers only, to be used with its
+   *   own buffers.
+   * @param imin First tile column.
+   * @param imax Last tile column + 1.
+   */
+  IPtTileSet *createColumnSubset (int imin, int imax) const;
+
   /**
    * \brief Creates a new point tile from loaded tiles.
    * Only in top access mode. The tile is saved in resources/til/top.
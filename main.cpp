@@ -50,6 +50,12 @@ int main (int argc, char *argv[])
             || ! autodet.config()->setBufferSize (atoi (argv[++i])))
           return 0;
       }
+      else if (string(argv[i]) == string ("--regions"))
+      {
+        if (i == argc - 1
+            || ! autodet.config()->setAsdRegions (atoi (argv[++i])))
+          return 0;
+      }
       else if (string(argv[i]) == string ("--tail"))
       {
         if (i == argc - 1
@@ -68,6 +74,12 @@ int main (int argc, char *argv[])
         autodet.config()->setBackDtm (true);
       else if (string(argv[i]) == string ("--unconnected"))
         autodet.config()->setConnected (false);
+      else if (string(argv[i]) == string ("--nfa"))
+        autodet.config()->setNfa (true);
+      else if (string(argv[i]) == string ("--dedup"))
+        autodet.config()->setSeedDedup (true);
+      else if (string(argv[i]) == string ("--stream"))
+        autodet.config()->setStream (true);
       else if (string(argv[i]) == string ("--half"))
         autodet.config()->setHalfSizeSeeds ();
       else if (string(argv[i]) == string ("--bsminlength"))